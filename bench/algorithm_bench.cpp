@@ -0,0 +1,101 @@
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include "uuidv7/uuidv7.hpp"
+#include "uuidv7/algorithm.hpp"
+#include "uuidv7/generator.hpp"
+
+namespace {
+
+// Generator output shuffled within windows of `window` elements (nearly sorted)
+std::vector<uuidv7::uuidv7> make_batch(std::size_t count, std::size_t window) {
+    std::vector<uuidv7::uuidv7> uuids;
+    uuids.reserve(count);
+    for (std::size_t i = 0; i < count; i++) uuids.push_back(uuidv7::uuidv7_generator::generate_default());
+    std::mt19937_64 rng(7);
+    for (std::size_t i = 0; i < count; i += window)
+        std::shuffle(uuids.begin() + i, uuids.begin() + std::min(i + window, count), rng);
+    return uuids;
+}
+
+} // namespace
+
+static void BM_StdSort(benchmark::State& state) {
+    auto batch = make_batch(static_cast<std::size_t>(state.range(0)), static_cast<std::size_t>(state.range(1)));
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto uuids = batch;
+        state.ResumeTiming();
+        std::sort(uuids.begin(), uuids.end());
+        benchmark::DoNotOptimize(uuids.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_StdSort)->ArgsProduct({ { 1 << 12, 1 << 20 }, { 64, 1 << 20 } });
+
+static void BM_SortUUIDs(benchmark::State& state) {
+    auto batch = make_batch(static_cast<std::size_t>(state.range(0)), static_cast<std::size_t>(state.range(1)));
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto uuids = batch;
+        state.ResumeTiming();
+        uuidv7::sort_uuids(uuids.data(), uuids.data() + uuids.size());
+        benchmark::DoNotOptimize(uuids.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SortUUIDs)->ArgsProduct({ { 1 << 12, 1 << 20 }, { 64, 1 << 20 } });
+
+static void BM_SortUUIDsParallel(benchmark::State& state) {
+    auto batch = make_batch(static_cast<std::size_t>(state.range(0)), static_cast<std::size_t>(state.range(1)));
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto uuids = batch;
+        state.ResumeTiming();
+        uuidv7::sort_uuids_parallel(uuids.data(), uuids.data() + uuids.size());
+        benchmark::DoNotOptimize(uuids.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SortUUIDsParallel)->ArgsProduct({ { 1 << 20 }, { 64, 1 << 20 } })->UseRealTime();
+
+namespace {
+
+// `count` generator outputs dealt round-robin into `runs` sorted runs
+std::vector<std::vector<uuidv7::uuidv7>> make_runs(std::size_t count, std::size_t runs) {
+    std::vector<std::vector<uuidv7::uuidv7>> result(runs);
+    for (std::size_t i = 0; i < count; i++) result[i % runs].push_back(uuidv7::uuidv7_generator::generate_default());
+    return result;
+}
+
+} // namespace
+
+static void BM_MergeUUIDs(benchmark::State& state) {
+    auto runs = make_runs(1 << 20, static_cast<std::size_t>(state.range(0)));
+    std::vector<uuidv7::uuidv7_run> pointer_runs;
+    for (const auto& run : runs) pointer_runs.emplace_back(run.data(), run.data() + run.size());
+    std::vector<uuidv7::uuidv7> out(runs[0].begin(), runs[0].end());
+    out.resize(1 << 20, out[0]);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(uuidv7::merge_uuids(pointer_runs, out.data()));
+    }
+    state.SetItemsProcessed(state.iterations() * (1 << 20));
+}
+BENCHMARK(BM_MergeUUIDs)->RangeMultiplier(4)->Range(2, 128);
+
+static void BM_MergeUUIDsParallel(benchmark::State& state) {
+    auto runs = make_runs(1 << 20, static_cast<std::size_t>(state.range(0)));
+    std::vector<uuidv7::uuidv7_run> pointer_runs;
+    for (const auto& run : runs) pointer_runs.emplace_back(run.data(), run.data() + run.size());
+    std::vector<uuidv7::uuidv7> out(runs[0].begin(), runs[0].end());
+    out.resize(1 << 20, out[0]);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(uuidv7::merge_uuids_parallel(pointer_runs, out.data()));
+    }
+    state.SetItemsProcessed(state.iterations() * (1 << 20));
+}
+BENCHMARK(BM_MergeUUIDsParallel)->RangeMultiplier(4)->Range(2, 128)->UseRealTime();
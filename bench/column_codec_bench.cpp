@@ -0,0 +1,58 @@
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include "uuidv7/uuidv7.hpp"
+#include "uuidv7/column_codec.hpp"
+#include "uuidv7/generator.hpp"
+
+namespace {
+
+// Generator output at a given rate, with the clock advancing every `per_ms` UUIDs
+struct stepped_clock {
+    static inline std::int64_t millis = 0;
+    static std::chrono::system_clock::time_point now() {
+        return std::chrono::system_clock::time_point(std::chrono::milliseconds(millis));
+    }
+};
+
+std::vector<uuidv7::uuidv7> make_uuids(std::size_t count, std::size_t per_ms) {
+    stepped_clock::millis = 1700000000000;
+    uuidv7::basic_uuidv7_generator<stepped_clock, uuidv7::csprng_entropy, uuidv7::null_lock, uuidv7::increment_counter> generator;
+    std::vector<uuidv7::uuidv7> uuids;
+    uuids.reserve(count);
+    for (std::size_t i = 0; i < count; i++) {
+        if (i % per_ms == 0) stepped_clock::millis++;
+        uuids.push_back(generator.generate());
+    }
+    return uuids;
+}
+
+} // namespace
+
+static void BM_ColumnEncode(benchmark::State& state) {
+    auto uuids = make_uuids(1 << 16, static_cast<std::size_t>(state.range(0)));
+    std::size_t bytes = 0;
+    for (auto _ : state) {
+        auto encoded = uuidv7::uuidv7_column_codec::encode(uuids.data(), uuids.data() + uuids.size());
+        bytes = encoded.size();
+        benchmark::DoNotOptimize(encoded.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(uuids.size()));
+    state.counters["bytes_per_uuid"] = static_cast<double>(bytes) / static_cast<double>(uuids.size());
+}
+BENCHMARK(BM_ColumnEncode)->Arg(1)->Arg(16)->Arg(1024);
+
+static void BM_ColumnDecode(benchmark::State& state) {
+    auto uuids = make_uuids(1 << 16, static_cast<std::size_t>(state.range(0)));
+    auto encoded = uuidv7::uuidv7_column_codec::encode(uuids.data(), uuids.data() + uuids.size());
+    uuidv7::uuidv7_column_codec::reader column(encoded.data(), encoded.size());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(column.decode_all(uuids.data()));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(uuids.size()));
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(encoded.size()));
+}
+BENCHMARK(BM_ColumnDecode)->Arg(1)->Arg(16)->Arg(1024);
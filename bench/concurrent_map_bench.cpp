@@ -0,0 +1,116 @@
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include "uuidv7/uuidv7.hpp"
+#include "uuidv7/concurrent_map.hpp"
+#include "uuidv7/generator.hpp"
+
+namespace {
+
+constexpr std::size_t KEYS = 1 << 20;
+
+const std::vector<uuidv7::uuidv7>& keys() {
+    static const std::vector<uuidv7::uuidv7> uuids = [] {
+        uuidv7::uuidv7_generator generator;
+        std::vector<uuidv7::uuidv7> result;
+        result.reserve(KEYS);
+        for (std::size_t i = 0; i < KEYS; i++) result.push_back(generator.generate());
+        return result;
+    }();
+    return uuids;
+}
+
+/// Baseline: `std::unordered_map` split into mutex-guarded shards by `std::hash<uuidv7>`
+class sharded_map {
+public:
+    explicit sharded_map(std::size_t capacity) {
+        for (auto& shard : shards_) shard.map.reserve(capacity / SHARDS);
+    }
+
+    bool find(const uuidv7::uuidv7& uuid, std::uint64_t& value) {
+        shard& s = get(uuid);
+        std::lock_guard<std::mutex> lock(s.mutex);
+        auto it = s.map.find(uuid);
+        if (it == s.map.end()) return false;
+        value = it->second;
+        return true;
+    }
+
+    void insert_or_assign(const uuidv7::uuidv7& uuid, std::uint64_t value) {
+        shard& s = get(uuid);
+        std::lock_guard<std::mutex> lock(s.mutex);
+        s.map.insert_or_assign(uuid, value);
+    }
+
+private:
+    static constexpr std::size_t SHARDS = 64;
+
+    struct alignas(64) shard {
+        std::mutex mutex;
+        std::unordered_map<uuidv7::uuidv7, std::uint64_t> map;
+    };
+
+    shard shards_[SHARDS];
+
+    shard& get(const uuidv7::uuidv7& uuid) { return shards_[std::hash<uuidv7::uuidv7>()(uuid) % SHARDS]; }
+};
+
+sharded_map& shared_sharded_map() {
+    static sharded_map map(KEYS);
+    static std::once_flag filled;
+    std::call_once(filled, [] {
+        for (std::size_t i = 0; i < KEYS; i++) map.insert_or_assign(keys()[i], i);
+    });
+    return map;
+}
+
+uuidv7::uuidv7_concurrent_map<std::uint64_t>& shared_concurrent_map() {
+    static uuidv7::uuidv7_concurrent_map<std::uint64_t> map(KEYS);
+    static std::once_flag filled;
+    std::call_once(filled, [] {
+        for (std::size_t i = 0; i < KEYS; i++) map.insert(keys()[i], i);
+    });
+    return map;
+}
+
+// Each thread walks the keys from its own offset; every `write_every`-th operation is an update
+template <class Lookup, class Update>
+void run(benchmark::State& state, std::size_t write_every, Lookup lookup, Update update) {
+    const auto& uuids = keys();
+    std::size_t i = static_cast<std::size_t>(state.thread_index()) * 7919 * 131;
+    std::uint64_t sum = 0;
+    for (auto _ : state) {
+        const auto& uuid = uuids[(i * 0x9E3779B97F4A7C15 >> 20) % KEYS];
+        if (write_every != 0 && i % write_every == 0) update(uuid, i);
+        else sum += lookup(uuid);
+        i++;
+    }
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(state.iterations());
+}
+
+} // namespace
+
+static void BM_ConcurrentMapRead(benchmark::State& state) {
+    auto& map = shared_concurrent_map();
+    run(state, static_cast<std::size_t>(state.range(0)),
+        [&](const uuidv7::uuidv7& uuid) { return *map.find(uuid); },
+        [&](const uuidv7::uuidv7& uuid, std::uint64_t value) { map.insert_or_assign(uuid, value); });
+}
+BENCHMARK(BM_ConcurrentMapRead)->Arg(0)->Arg(16)->ThreadRange(1, 8)->UseRealTime();
+
+static void BM_ShardedUnorderedMapRead(benchmark::State& state) {
+    auto& map = shared_sharded_map();
+    run(state, static_cast<std::size_t>(state.range(0)),
+        [&](const uuidv7::uuidv7& uuid) {
+            std::uint64_t value = 0;
+            map.find(uuid, value);
+            return value;
+        },
+        [&](const uuidv7::uuidv7& uuid, std::uint64_t value) { map.insert_or_assign(uuid, value); });
+}
+BENCHMARK(BM_ShardedUnorderedMapRead)->Arg(0)->Arg(16)->ThreadRange(1, 8)->UseRealTime();
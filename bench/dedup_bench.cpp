@@ -0,0 +1,27 @@
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include "uuidv7/uuidv7.hpp"
+#include "uuidv7/dedup.hpp"
+
+// Steady state: a stream of 100k IDs per second through a 10-second window, 1 in 8 is a retry
+static void BM_DedupWindowInsert(benchmark::State& state) {
+    constexpr std::uint64_t PER_SECOND = 100000;
+    std::vector<uuidv7::uuidv7> stream;
+    for (std::uint64_t i = 0; i < PER_SECOND * 30; i++) {
+        std::uint64_t millis = 1000000 + i * 1000 / PER_SECOND;
+        stream.push_back(uuidv7::uuidv7::from_fields(millis, 0, i));
+        if (i % 8 == 0 && i >= 1000) stream.push_back(stream[stream.size() - 1000]);
+    }
+    std::size_t duplicates = 0;
+    for (auto _ : state) {
+        uuidv7::uuidv7_dedup_window window(std::chrono::seconds(10));
+        for (const auto& uuid : stream)
+            duplicates += window.insert(uuid) == uuidv7::uuidv7_dedup_window::status::duplicate;
+    }
+    benchmark::DoNotOptimize(duplicates);
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(stream.size()));
+}
+BENCHMARK(BM_DedupWindowInsert)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,79 @@
+#include <array>
+#include <string>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include "uuidv7/uuidv7.hpp"
+#include "uuidv7/generator.hpp"
+
+namespace {
+
+std::vector<uuidv7::uuidv7> make_uuids() {
+    std::vector<uuidv7::uuidv7> uuids;
+    for (int i = 0; i < 1024; i++) uuids.push_back(uuidv7::uuidv7_generator::generate_default());
+    return uuids;
+}
+
+template <class Encode>
+std::vector<std::string> encode_all(const std::vector<uuidv7::uuidv7>& uuids, Encode encode) {
+    std::vector<std::string> strings;
+    for (const auto& uuid : uuids) strings.push_back(encode(uuid));
+    return strings;
+}
+
+} // namespace
+
+static void BM_ToString(benchmark::State& state) {
+    auto uuids = make_uuids();
+    std::size_t i = 0;
+    for (auto _ : state) benchmark::DoNotOptimize(uuids[i++ & 1023].to_string());
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ToString);
+
+static void BM_ToCharsBase32(benchmark::State& state) {
+    auto uuids = make_uuids();
+    std::array<char, uuidv7::uuidv7::BASE32_LENGTH> buffer;
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(uuids[i++ & 1023].to_chars_base32(buffer.data(), buffer.data() + buffer.size()));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ToCharsBase32);
+
+static void BM_ToCharsBase64url(benchmark::State& state) {
+    auto uuids = make_uuids();
+    std::array<char, uuidv7::uuidv7::BASE64URL_LENGTH> buffer;
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(uuids[i++ & 1023].to_chars_base64url(buffer.data(), buffer.data() + buffer.size()));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ToCharsBase64url);
+
+static void BM_Parse(benchmark::State& state) {
+    auto strings = encode_all(make_uuids(), [](const uuidv7::uuidv7& uuid) { return uuid.to_string(); });
+    std::size_t i = 0;
+    for (auto _ : state) benchmark::DoNotOptimize(uuidv7::uuidv7::parse(strings[i++ & 1023]));
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Parse);
+
+static void BM_ParseBase32(benchmark::State& state) {
+    auto strings = encode_all(make_uuids(), [](const uuidv7::uuidv7& uuid) { return uuid.to_base32(); });
+    std::size_t i = 0;
+    for (auto _ : state) benchmark::DoNotOptimize(uuidv7::uuidv7::parse_base32(strings[i++ & 1023]));
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ParseBase32);
+
+static void BM_ParseBase64url(benchmark::State& state) {
+    auto strings = encode_all(make_uuids(), [](const uuidv7::uuidv7& uuid) { return uuid.to_base64url(); });
+    std::size_t i = 0;
+    for (auto _ : state) benchmark::DoNotOptimize(uuidv7::uuidv7::parse_base64url(strings[i++ & 1023]));
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ParseBase64url);
@@ -0,0 +1,75 @@
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include "uuidv7/uuidv7.hpp"
+#include "uuidv7/filter.hpp"
+#include "uuidv7/flat_hash.hpp"
+#include "uuidv7/generator.hpp"
+
+namespace {
+
+std::vector<uuidv7::uuidv7> make_uuids(std::size_t count) {
+    uuidv7::uuidv7_generator generator;
+    std::vector<uuidv7::uuidv7> uuids;
+    uuids.reserve(count);
+    for (std::size_t i = 0; i < count; i++) uuids.push_back(generator.generate());
+    return uuids;
+}
+
+// Lookups of absent IDs, the case the filters exist for
+template <class Filter>
+void miss_bench(benchmark::State& state, Filter& filter) {
+    auto uuids = make_uuids(static_cast<std::size_t>(state.range(0)));
+    for (const auto& uuid : uuids) filter.insert(uuid);
+    auto probes = make_uuids(uuids.size());
+    for (auto _ : state) {
+        std::size_t found = 0;
+        for (const auto& uuid : probes) found += filter.contains(uuid);
+        benchmark::DoNotOptimize(found);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // namespace
+
+static void BM_BloomFilterInsert(benchmark::State& state) {
+    auto uuids = make_uuids(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        uuidv7::uuidv7_bloom_filter filter(uuids.size());
+        for (const auto& uuid : uuids) filter.insert(uuid);
+        benchmark::DoNotOptimize(filter.bytes().data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_BloomFilterInsert)->Arg(1 << 16)->Arg(1 << 22);
+
+static void BM_BloomFilterMiss(benchmark::State& state) {
+    uuidv7::uuidv7_bloom_filter filter(static_cast<std::size_t>(state.range(0)));
+    miss_bench(state, filter);
+}
+BENCHMARK(BM_BloomFilterMiss)->Arg(1 << 16)->Arg(1 << 22);
+
+static void BM_CuckooFilterInsert(benchmark::State& state) {
+    auto uuids = make_uuids(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        uuidv7::uuidv7_cuckoo_filter filter(uuids.size());
+        for (const auto& uuid : uuids) filter.insert(uuid);
+        benchmark::DoNotOptimize(filter.size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_CuckooFilterInsert)->Arg(1 << 16)->Arg(1 << 22);
+
+static void BM_CuckooFilterMiss(benchmark::State& state) {
+    uuidv7::uuidv7_cuckoo_filter filter(static_cast<std::size_t>(state.range(0)));
+    miss_bench(state, filter);
+}
+BENCHMARK(BM_CuckooFilterMiss)->Arg(1 << 16)->Arg(1 << 22);
+
+// Baseline: the same negative lookups in an exact hash set
+static void BM_FlatSetMiss(benchmark::State& state) {
+    uuidv7::uuidv7_flat_set<> set;
+    miss_bench(state, set);
+}
+BENCHMARK(BM_FlatSetMiss)->Arg(1 << 16)->Arg(1 << 22);
@@ -0,0 +1,90 @@
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include "uuidv7/uuidv7.hpp"
+#include "uuidv7/flat_hash.hpp"
+#include "uuidv7/generator.hpp"
+
+namespace {
+
+std::vector<uuidv7::uuidv7> make_uuids(std::size_t count) {
+    uuidv7::uuidv7_generator generator;
+    std::vector<uuidv7::uuidv7> uuids;
+    uuids.reserve(count);
+    for (std::size_t i = 0; i < count; i++) uuids.push_back(generator.generate());
+    return uuids;
+}
+
+/// Lookup keys: `uuids` in a scattered order, or as many UUIDs absent from the container
+std::vector<uuidv7::uuidv7> make_probes(const std::vector<uuidv7::uuidv7>& uuids, bool hit) {
+    std::vector<uuidv7::uuidv7> probes = hit ? uuids : make_uuids(uuids.size());
+    for (std::size_t i = probes.size(); i > 1; i--) std::swap(probes[i - 1], probes[(i * 0x9E3779B97F4A7C15) % i]);
+    return probes;
+}
+
+template <class Set>
+void insert_bench(benchmark::State& state) {
+    auto uuids = make_uuids(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        Set set;
+        for (const auto& uuid : uuids) set.insert(uuid);
+        benchmark::DoNotOptimize(set.size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class Set>
+void lookup_bench(benchmark::State& state, bool hit) {
+    auto uuids = make_uuids(static_cast<std::size_t>(state.range(0)));
+    Set set;
+    for (const auto& uuid : uuids) set.insert(uuid);
+    auto probes = make_probes(uuids, hit);
+    for (auto _ : state) {
+        std::size_t found = 0;
+        for (const auto& uuid : probes) found += set.count(uuid);
+        benchmark::DoNotOptimize(found);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // namespace
+
+static void BM_FlatSetInsert(benchmark::State& state) { insert_bench<uuidv7::uuidv7_flat_set<>>(state); }
+BENCHMARK(BM_FlatSetInsert)->Range(1 << 10, 1 << 22);
+static void BM_UnorderedSetInsert(benchmark::State& state) { insert_bench<std::unordered_set<uuidv7::uuidv7>>(state); }
+BENCHMARK(BM_UnorderedSetInsert)->Range(1 << 10, 1 << 22);
+
+static void BM_FlatSetLookupHit(benchmark::State& state) { lookup_bench<uuidv7::uuidv7_flat_set<>>(state, true); }
+BENCHMARK(BM_FlatSetLookupHit)->Range(1 << 10, 1 << 22);
+static void BM_UnorderedSetLookupHit(benchmark::State& state) { lookup_bench<std::unordered_set<uuidv7::uuidv7>>(state, true); }
+BENCHMARK(BM_UnorderedSetLookupHit)->Range(1 << 10, 1 << 22);
+
+static void BM_FlatSetLookupMiss(benchmark::State& state) { lookup_bench<uuidv7::uuidv7_flat_set<>>(state, false); }
+BENCHMARK(BM_FlatSetLookupMiss)->Range(1 << 10, 1 << 22);
+static void BM_UnorderedSetLookupMiss(benchmark::State& state) { lookup_bench<std::unordered_set<uuidv7::uuidv7>>(state, false); }
+BENCHMARK(BM_UnorderedSetLookupMiss)->Range(1 << 10, 1 << 22);
+
+static void BM_FlatMapUpsert(benchmark::State& state) {
+    auto uuids = make_uuids(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        uuidv7::uuidv7_flat_map<std::uint64_t> map;
+        for (const auto& uuid : uuids) map[uuid]++;
+        benchmark::DoNotOptimize(map.size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_FlatMapUpsert)->Range(1 << 10, 1 << 22);
+
+static void BM_UnorderedMapUpsert(benchmark::State& state) {
+    auto uuids = make_uuids(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        std::unordered_map<uuidv7::uuidv7, std::uint64_t> map;
+        for (const auto& uuid : uuids) map[uuid]++;
+        benchmark::DoNotOptimize(map.size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_UnorderedMapUpsert)->Range(1 << 10, 1 << 22);
@@ -0,0 +1,62 @@
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <benchmark/benchmark.h>
+#include "uuidv7/uuidv7.hpp"
+#include "uuidv7/generator.hpp"
+#ifndef _WIN32
+    #include "uuidv7/shared_generator.hpp"
+#endif
+
+namespace {
+
+template <class Generator>
+void BM_Generate(benchmark::State& state) {
+    static Generator generator;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(generator.generate());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// One lock acquisition per block of IDs instead of per ID
+template <class Generator>
+void BM_GenerateLease(benchmark::State& state) {
+    static Generator generator;
+    const auto block = static_cast<std::size_t>(state.range(0));
+    auto lease = generator.reserve(block);
+    for (auto _ : state) {
+        if (lease.empty()) lease = generator.reserve(block);
+        benchmark::DoNotOptimize(lease.next());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+using system_clock = std::chrono::system_clock;
+using coarse_clock = uuidv7::coarse_system_clock;
+using csprng = uuidv7::csprng_entropy;
+using counter = uuidv7::increment_counter;
+
+} // namespace
+
+BENCHMARK(BM_Generate<uuidv7::uuidv7_generator>)->ThreadRange(1, 4);
+BENCHMARK(BM_Generate<uuidv7::basic_uuidv7_generator<system_clock, csprng, uuidv7::spin_lock, counter>>)->ThreadRange(1, 4);
+BENCHMARK(BM_Generate<uuidv7::basic_uuidv7_generator<system_clock, csprng, uuidv7::null_lock, counter>>);
+BENCHMARK(BM_Generate<uuidv7::basic_uuidv7_generator<coarse_clock, csprng, std::mutex, counter>>)->ThreadRange(1, 4);
+BENCHMARK(BM_Generate<uuidv7::basic_uuidv7_generator<coarse_clock, csprng, uuidv7::null_lock, counter>>);
+BENCHMARK(BM_GenerateLease<uuidv7::uuidv7_generator>)->Arg(64)->Arg(1024)->ThreadRange(1, 4);
+
+#ifndef _WIN32
+static void BM_GenerateShared(benchmark::State& state) {
+    static auto generator = [] {
+        auto g = uuidv7::shared_uuidv7_generator::open_shared_memory("/uuidv7lib_bench");
+        uuidv7::shared_uuidv7_generator::remove_shared_memory("/uuidv7lib_bench");
+        return g;
+    }();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(generator.generate());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_GenerateShared)->ThreadRange(1, 4);
+#endif
@@ -0,0 +1,72 @@
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include "uuidv7/uuidv7.hpp"
+#include "uuidv7/generator.hpp"
+#include "uuidv7/partition.hpp"
+
+namespace {
+
+std::vector<uuidv7::uuidv7> make_uuids(std::size_t count) {
+    uuidv7::uuidv7_generator generator;
+    std::vector<uuidv7::uuidv7> uuids;
+    uuids.reserve(count);
+    for (std::size_t i = 0; i < count; i++) uuids.push_back(generator.generate());
+    return uuids;
+}
+
+template <class Partitioner>
+void scatter_bench(benchmark::State& state, const Partitioner& partitioner) {
+    auto uuids = make_uuids(1 << 20);
+    std::vector<uuidv7::uuidv7> out(uuids.size(), uuids[0]);
+    for (auto _ : state) {
+        auto offsets = uuidv7::partition_uuids(uuids.data(), uuids.data() + uuids.size(), out.data(), partitioner);
+        benchmark::DoNotOptimize(offsets.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(uuids.size()));
+}
+
+template <class Partitioner>
+void buffers_bench(benchmark::State& state, const Partitioner& partitioner) {
+    auto uuids = make_uuids(1 << 20);
+    std::vector<std::vector<uuidv7::uuidv7>> buffers;
+    for (auto _ : state) {
+        for (auto& buffer : buffers) buffer.clear();
+        uuidv7::partition_uuids(uuids.data(), uuids.data() + uuids.size(), partitioner, buffers);
+        benchmark::DoNotOptimize(buffers.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(uuids.size()));
+}
+
+} // namespace
+
+static void BM_PartitionHash(benchmark::State& state) {
+    scatter_bench(state, uuidv7::uuidv7_hash_partitioner(static_cast<std::size_t>(state.range(0))));
+}
+BENCHMARK(BM_PartitionHash)->Arg(16)->Arg(256);
+
+static void BM_PartitionHashBuffers(benchmark::State& state) {
+    buffers_bench(state, uuidv7::uuidv7_hash_partitioner(static_cast<std::size_t>(state.range(0))));
+}
+BENCHMARK(BM_PartitionHashBuffers)->Arg(16)->Arg(256);
+
+static void BM_PartitionTime(benchmark::State& state) {
+    scatter_bench(state, uuidv7::uuidv7_time_partitioner(static_cast<std::size_t>(state.range(0)), std::chrono::milliseconds(1)));
+}
+BENCHMARK(BM_PartitionTime)->Arg(16)->Arg(256);
+
+// Baseline: one shard computation and push_back per UUID
+static void BM_PartitionHashNaive(benchmark::State& state) {
+    uuidv7::uuidv7_hash_partitioner partitioner(static_cast<std::size_t>(state.range(0)));
+    auto uuids = make_uuids(1 << 20);
+    std::vector<std::vector<uuidv7::uuidv7>> buffers(partitioner.shard_count());
+    for (auto _ : state) {
+        for (auto& buffer : buffers) buffer.clear();
+        for (const auto& uuid : uuids) buffers[partitioner(uuid)].push_back(uuid);
+        benchmark::DoNotOptimize(buffers.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(uuids.size()));
+}
+BENCHMARK(BM_PartitionHashNaive)->Arg(16)->Arg(256);
@@ -0,0 +1,50 @@
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <benchmark/benchmark.h>
+#include "uuidv7/uuidv7.hpp"
+#include "uuidv7/generator.hpp"
+#include "uuidv7/scan.hpp"
+
+namespace {
+
+/// Log-like text: lines of about 160 characters with hyphenated words, one UUID every `every` lines
+std::string make_log(std::size_t size, std::size_t every) {
+    std::string text;
+    for (std::size_t line = 0; text.size() < size; line++) {
+        text += "2025-04-30T12:34:56.789Z INFO http-server request-handler GET /api/v1/items status=200 ";
+        if (line % every == 0) text += "request_id=" + uuidv7::uuidv7_generator::generate_default().to_string();
+        else text += "duration=12ms user-agent=curl/8.5.0 x-forwarded-for=10.0.0.1";
+        text += '\n';
+    }
+    return text;
+}
+
+} // namespace
+
+static void BM_FindUUIDs(benchmark::State& state) {
+    auto text = make_log(1 << 20, static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        std::size_t count = uuidv7::find_uuids(text, [](const uuidv7::uuidv7& uuid, std::uint64_t) {
+            benchmark::DoNotOptimize(uuid);
+        });
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(text.size()));
+}
+BENCHMARK(BM_FindUUIDs)->Arg(1)->Arg(16);
+
+static void BM_ScannerChunks(benchmark::State& state) {
+    auto text = make_log(1 << 20, 1);
+    auto chunk_size = static_cast<std::size_t>(state.range(0));
+    for (auto _ : state) {
+        uuidv7::uuidv7_scanner scanner;
+        auto sink = [](const uuidv7::uuidv7& uuid, std::uint64_t) { benchmark::DoNotOptimize(uuid); };
+        for (std::size_t i = 0; i < text.size(); i += chunk_size)
+            scanner.feed(std::string_view(text).substr(i, chunk_size), sink);
+        scanner.finish(sink);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(text.size()));
+}
+BENCHMARK(BM_ScannerChunks)->Arg(4 << 10)->Arg(64 << 10);
@@ -0,0 +1,61 @@
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include "uuidv7/uuidv7.hpp"
+#include "uuidv7/time_index.hpp"
+
+namespace {
+
+using ms_time_point = std::chrono::time_point<std::chrono::system_clock, std::chrono::milliseconds>;
+
+// One UUID per millisecond starting at the epoch, so query times map directly to ranks
+std::vector<uuidv7::uuidv7> make_uuids(std::size_t count) {
+    std::vector<uuidv7::uuidv7> uuids;
+    uuids.reserve(count);
+    for (std::size_t i = 0; i < count; i++)
+        uuids.push_back(uuidv7::uuidv7::min_for_time(ms_time_point(std::chrono::milliseconds(i))));
+    return uuids;
+}
+
+std::vector<ms_time_point> make_queries(std::size_t count) {
+    std::mt19937_64 rng(7);
+    std::uniform_int_distribution<std::int64_t> dist(0, static_cast<std::int64_t>(count));
+    std::vector<ms_time_point> queries(1024);
+    for (auto& q : queries) q = ms_time_point(std::chrono::milliseconds(dist(rng)));
+    return queries;
+}
+
+} // namespace
+
+static void BM_TimeIndexRange(benchmark::State& state) {
+    auto count = static_cast<std::size_t>(state.range(0));
+    uuidv7::uuidv7_time_index index(make_uuids(count));
+    auto queries = make_queries(count);
+    std::size_t i = 0;
+    for (auto _ : state) {
+        auto tp = queries[i++ & 1023];
+        benchmark::DoNotOptimize(index.find_range(tp, tp + std::chrono::milliseconds(100)));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TimeIndexRange)->Range(1 << 10, 1 << 24);
+
+static void BM_StdLowerBoundRange(benchmark::State& state) {
+    auto count = static_cast<std::size_t>(state.range(0));
+    auto uuids = make_uuids(count);
+    auto queries = make_queries(count);
+    std::size_t i = 0;
+    for (auto _ : state) {
+        auto tp = queries[i++ & 1023];
+        auto first = std::lower_bound(uuids.begin(), uuids.end(), uuidv7::uuidv7::min_for_time(tp));
+        auto last = std::upper_bound(first, uuids.end(), uuidv7::uuidv7::max_for_time(tp + std::chrono::milliseconds(100)));
+        benchmark::DoNotOptimize(first);
+        benchmark::DoNotOptimize(last);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_StdLowerBoundRange)->Range(1 << 10, 1 << 24);
@@ -0,0 +1,49 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include "uuidv7/uuidv7.hpp"
+#include "uuidv7/generator.hpp"
+#include "uuidv7/validate.hpp"
+
+namespace {
+
+std::vector<std::uint8_t> make_buffer(std::size_t count) {
+    std::vector<std::uint8_t> buffer(count * 16);
+    for (std::size_t i = 0; i < count; i++)
+        std::memcpy(&buffer[i * 16], uuidv7::uuidv7_generator::generate_default().get_bytes().data(), 16);
+    return buffer;
+}
+
+} // namespace
+
+static void BM_ValidateMany(benchmark::State& state) {
+    auto count = static_cast<std::size_t>(state.range(0));
+    auto buffer = make_buffer(count);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(uuidv7::validate_many(buffer.data(), count));
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(buffer.size()));
+}
+BENCHMARK(BM_ValidateMany)->Range(1 << 10, 1 << 22);
+
+static void BM_ValidateManyBitmap(benchmark::State& state) {
+    auto count = static_cast<std::size_t>(state.range(0));
+    auto buffer = make_buffer(count);
+    std::vector<std::uint64_t> bitmap((count + 63) / 64);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(uuidv7::validate_many(buffer.data(), count, bitmap.data()));
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(buffer.size()));
+}
+BENCHMARK(BM_ValidateManyBitmap)->Range(1 << 10, 1 << 22);
+
+static void BM_FromBytesLoop(benchmark::State& state) {
+    auto count = static_cast<std::size_t>(state.range(0));
+    auto buffer = make_buffer(count);
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < count; i++)
+            benchmark::DoNotOptimize(uuidv7::uuidv7::from_bytes(&buffer[i * 16]));
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(buffer.size()));
+}
+BENCHMARK(BM_FromBytesLoop)->Range(1 << 10, 1 << 22);
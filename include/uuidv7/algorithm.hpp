@@ -0,0 +1,364 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "uuidv7.hpp"
+
+#if __cpp_lib_span >= 202002L
+    #include <span>
+#endif
+
+namespace uuidv7 {
+
+/// @brief Sorted run of `uuidv7` values given as a `[first, last)` pointer range
+using uuidv7_run = std::pair<const uuidv7*, const uuidv7*>;
+
+/// @cond Doxygen_suppress
+namespace detail {
+    /// Buckets shorter than this are sorted with `std::sort`
+    constexpr std::size_t RADIX_SORT_THRESHOLD = 64;
+    /// Inputs shorter than this are not split across threads
+    constexpr std::size_t PARALLEL_SORT_THRESHOLD = 1 << 16;
+
+    static_assert(sizeof(uuidv7) == 16 && std::is_standard_layout<uuidv7>::value,
+                  "uuidv7 must consist of its 16 bytes only");
+
+    /// Read byte `k` of the UUID through its object representation (no copy of the array)
+    inline std::uint8_t byte_at(const uuidv7& uuid, int k) noexcept {
+        return reinterpret_cast<const std::uint8_t*>(&uuid)[k];
+    }
+
+    /// MSD radix sort (American flag sort) of `data[0, n)` starting at byte position `k`.
+    /// Sorts in place without a scratch buffer.
+    inline void radix_sort_uuids(uuidv7* data, std::size_t n, int k = 0) {
+        std::array<std::size_t, 256> count;
+        std::array<std::size_t, 256> head;
+        std::array<std::size_t, 256> tail;
+        while (k < 16) {
+            if (n < RADIX_SORT_THRESHOLD) {
+                std::sort(data, data + n);
+                return;
+            }
+
+            count.fill(0);
+            for (std::size_t i = 0; i < n; i++) count[byte_at(data[i], k)]++;
+            // Timestamps of a batch share long prefixes: skip bytes holding one value only
+            if (std::find(count.begin(), count.end(), n) != count.end()) {
+                k++;
+                continue;
+            }
+
+            std::size_t offset = 0;
+            for (int b = 0; b < 256; b++) {
+                head[b] = offset;
+                offset += count[b];
+                tail[b] = offset;
+            }
+            // Move every element into its bucket by following permutation cycles
+            for (int b = 0; b < 256; b++) {
+                while (head[b] < tail[b]) {
+                    uuidv7 value = data[head[b]];
+                    std::uint8_t digit = byte_at(value, k);
+                    while (digit != b) {
+                        std::swap(value, data[head[digit]++]);
+                        digit = byte_at(value, k);
+                    }
+                    data[head[b]++] = value;
+                }
+            }
+
+            for (int b = 0; b < 256; b++) {
+                std::size_t begin = tail[b] - count[b];
+                if (count[b] > 1) radix_sort_uuids(data + begin, count[b], k + 1);
+            }
+            return;
+        }
+    }
+
+    /// UUID as a 128-bit big-endian key (for value-space binary search)
+    struct uuid_key {
+        std::uint64_t upper;
+        std::uint64_t lower;
+
+        static uuid_key of(const uuidv7& uuid) noexcept {
+            const auto* bytes = reinterpret_cast<const std::uint8_t*>(&uuid);
+            return { load_be64(bytes), load_be64(bytes + 8) };
+        }
+        friend bool operator<(const uuid_key& lhs, const uuid_key& rhs) noexcept {
+            return lhs.upper != rhs.upper ? lhs.upper < rhs.upper : lhs.lower < rhs.lower;
+        }
+        friend bool operator==(const uuid_key& lhs, const uuid_key& rhs) noexcept {
+            return lhs.upper == rhs.upper && lhs.lower == rhs.lower;
+        }
+        /// Midpoint of [lhs, rhs] rounded down
+        static uuid_key midpoint(const uuid_key& lhs, const uuid_key& rhs) noexcept {
+            // 129-bit sum shifted right by one
+            std::uint64_t lower = lhs.lower + rhs.lower;
+            std::uint64_t carry = lower < lhs.lower ? 1 : 0;
+            std::uint64_t upper = lhs.upper + rhs.upper + carry;
+            std::uint64_t overflow = (upper < lhs.upper || (carry && upper == lhs.upper)) ? 1 : 0;
+            return { (upper >> 1) | (overflow << 63), (lower >> 1) | (upper << 63) };
+        }
+        uuid_key next() const noexcept { return lower == ~std::uint64_t(0) ? uuid_key{ upper + 1, 0 } : uuid_key{ upper, lower + 1 }; }
+    };
+
+    /// Tournament tree of losers over K sorted runs
+    class loser_tree {
+    public:
+        loser_tree(const uuidv7_run* runs, std::size_t k)
+            : k_(k), leaves_(1), current_(k), last_(k)
+        {
+            for (std::size_t i = 0; i < k; i++) {
+                current_[i] = runs[i].first;
+                last_[i] = runs[i].second;
+            }
+            while (leaves_ < k) leaves_ *= 2;
+            tree_.assign(leaves_, 0);
+            tree_[0] = build(1);
+        }
+
+        bool empty() const noexcept { return exhausted(tree_[0]); }
+
+        const uuidv7& top() const noexcept { return *current_[tree_[0]]; }
+
+        void pop() noexcept {
+            std::size_t winner = tree_[0];
+            current_[winner]++;
+            for (std::size_t node = (leaves_ + winner) / 2; node > 0; node /= 2) {
+                if (beats(tree_[node], winner)) std::swap(tree_[node], winner);
+            }
+            tree_[0] = winner;
+        }
+
+    private:
+        std::size_t k_;
+        std::size_t leaves_;
+        std::vector<const uuidv7*> current_;
+        std::vector<const uuidv7*> last_;
+        // tree_[0] holds the winner, tree_[1, leaves_) the loser of each match
+        std::vector<std::size_t> tree_;
+
+        bool exhausted(std::size_t run) const noexcept { return run >= k_ || current_[run] == last_[run]; }
+
+        /// Whether run `a` wins over run `b` (ties go to the earlier run, keeping the merge stable)
+        bool beats(std::size_t a, std::size_t b) const noexcept {
+            if (exhausted(a)) return false;
+            if (exhausted(b)) return true;
+            if (*current_[a] < *current_[b]) return true;
+            if (*current_[b] < *current_[a]) return false;
+            return a < b;
+        }
+
+        std::size_t build(std::size_t node) {
+            if (node >= leaves_) return node - leaves_;
+            std::size_t left = build(2 * node);
+            std::size_t right = build(2 * node + 1);
+            if (beats(left, right)) {
+                tree_[node] = right;
+                return left;
+            }
+            tree_[node] = left;
+            return right;
+        }
+    };
+
+    /// Positions splitting each run so that exactly `rank` elements precede the split in merged order
+    inline std::vector<std::size_t> split_runs(const uuidv7_run* runs, std::size_t k, std::size_t rank) {
+        auto key_less = [](const uuidv7& uuid, const uuid_key& key) { return uuid_key::of(uuid) < key; };
+        auto count_less = [&](const uuid_key& key) {
+            std::size_t count = 0;
+            for (std::size_t i = 0; i < k; i++)
+                count += static_cast<std::size_t>(std::lower_bound(runs[i].first, runs[i].second, key, key_less) - runs[i].first);
+            return count;
+        };
+
+        // Find the largest key with fewer than `rank` smaller elements (= the element of that rank)
+        uuid_key low { 0, 0 }, high { ~std::uint64_t(0), ~std::uint64_t(0) };
+        while (low < high) {
+            uuid_key mid = uuid_key::midpoint(low, high).next();
+            if (count_less(mid) <= rank) low = mid;
+            else high = { mid.upper - (mid.lower == 0 ? 1 : 0), mid.lower - 1 };
+        }
+
+        // Take all elements less than the key, then equal elements from the earliest runs
+        std::vector<std::size_t> split(k);
+        std::size_t remaining = rank;
+        for (std::size_t i = 0; i < k; i++) {
+            split[i] = static_cast<std::size_t>(std::lower_bound(runs[i].first, runs[i].second, low, key_less) - runs[i].first);
+            remaining -= split[i];
+        }
+        for (std::size_t i = 0; i < k && remaining > 0; i++) {
+            auto equal_end = std::upper_bound(runs[i].first + split[i], runs[i].second, low,
+                [](const uuid_key& key, const uuidv7& uuid) { return key < uuid_key::of(uuid); });
+            std::size_t take = std::min(remaining, static_cast<std::size_t>(equal_end - (runs[i].first + split[i])));
+            split[i] += take;
+            remaining -= take;
+        }
+        return split;
+    }
+
+    template <class Function>
+    void run_parallel(unsigned thread_count, Function&& function) {
+        if (thread_count == 0) return;
+        std::vector<std::thread> threads;
+        threads.reserve(thread_count - 1);
+        for (unsigned t = 1; t < thread_count; t++) threads.emplace_back(function, t);
+        function(0u);
+        for (auto& thread : threads) thread.join();
+    }
+
+    inline unsigned default_thread_count(unsigned thread_count) noexcept {
+        if (thread_count == 0) thread_count = std::thread::hardware_concurrency();
+        return thread_count == 0 ? 1 : thread_count;
+    }
+} // namespace detail
+/// @endcond
+
+/// @brief Sort `uuidv7` values in ascending order with a radix sort
+///
+/// Performs an in-place MSD radix sort (American flag sort) over the 16 bytes of the UUIDs.
+/// Byte positions that hold the same value in every element of a bucket (typically the
+/// leading timestamp bytes of a batch) are skipped, buckets become small after a few
+/// passes and are finished with `std::sort`, and already sorted input returns after a single scan.
+///
+/// @param first Pointer to the first element
+/// @param last Pointer past the last element
+inline void sort_uuids(uuidv7* first, uuidv7* last) {
+    if (std::is_sorted(first, last)) return;
+    detail::radix_sort_uuids(first, static_cast<std::size_t>(last - first));
+}
+
+/// @brief Merge sorted runs of `uuidv7` values into one sorted sequence
+///
+/// Uses a tournament tree of losers, so each output element costs about log2(K) comparisons.
+/// The merge is stable: equal values are taken from earlier runs first.
+///
+/// @param runs Sorted input runs
+/// @param out Output buffer (must hold the total number of elements and not overlap the runs)
+/// @return Pointer past the last written element
+inline uuidv7* merge_uuids(const std::vector<uuidv7_run>& runs, uuidv7* out) {
+    if (runs.empty()) return out;
+    if (runs.size() == 1) return std::copy(runs[0].first, runs[0].second, out);
+
+    detail::loser_tree tree(runs.data(), runs.size());
+    while (!tree.empty()) {
+        *out++ = tree.top();
+        tree.pop();
+    }
+    return out;
+}
+
+/// @brief Merge sorted runs of `uuidv7` values into one sorted sequence using multiple threads
+///
+/// The output is divided into equal parts, and the position where each part starts in
+/// every run is found by a k-way generalization of merge path (a binary search for the
+/// element of the part's starting rank). The parts are then merged concurrently.
+/// The result is identical to `merge_uuids()`.
+///
+/// @param runs Sorted input runs
+/// @param out Output buffer (must hold the total number of elements and not overlap the runs)
+/// @param thread_count Number of threads (0: `std::thread::hardware_concurrency()`)
+/// @return Pointer past the last written element
+inline uuidv7* merge_uuids_parallel(const std::vector<uuidv7_run>& runs, uuidv7* out, unsigned thread_count = 0) {
+    std::size_t total = 0;
+    for (const auto& run : runs) total += static_cast<std::size_t>(run.second - run.first);
+    thread_count = detail::default_thread_count(thread_count);
+    if (thread_count == 1 || runs.size() < 2 || total < detail::PARALLEL_SORT_THRESHOLD)
+        return merge_uuids(runs, out);
+
+    std::vector<std::vector<std::size_t>> splits(thread_count + 1);
+    detail::run_parallel(thread_count - 1, [&](unsigned t) {
+        splits[t + 1] = detail::split_runs(runs.data(), runs.size(), total * (t + 1) / thread_count);
+    });
+    splits[0].assign(runs.size(), 0);
+    for (const auto& run : runs) splits[thread_count].push_back(static_cast<std::size_t>(run.second - run.first));
+
+    detail::run_parallel(thread_count, [&](unsigned t) {
+        std::vector<uuidv7_run> parts(runs.size());
+        for (std::size_t i = 0; i < runs.size(); i++)
+            parts[i] = { runs[i].first + splits[t][i], runs[i].first + splits[t + 1][i] };
+        merge_uuids(parts, out + total * t / thread_count);
+    });
+    return out + total;
+}
+
+/// @brief Sort `uuidv7` values in ascending order with a radix sort using multiple threads
+///
+/// The input is split into one chunk per thread, each chunk is radix sorted concurrently,
+/// and the sorted chunks are combined with `merge_uuids_parallel()`.
+///
+/// @param first Pointer to the first element
+/// @param last Pointer past the last element
+/// @param thread_count Number of threads (0: `std::thread::hardware_concurrency()`)
+/// @note Allocates a scratch buffer of the same size as the input for merging.
+inline void sort_uuids_parallel(uuidv7* first, uuidv7* last, unsigned thread_count = 0) {
+    const auto n = static_cast<std::size_t>(last - first);
+    thread_count = detail::default_thread_count(thread_count);
+    if (thread_count == 1 || n < detail::PARALLEL_SORT_THRESHOLD) {
+        sort_uuids(first, last);
+        return;
+    }
+    if (std::is_sorted(first, last)) return;
+
+    std::vector<uuidv7_run> runs(thread_count);
+    detail::run_parallel(thread_count, [&](unsigned t) {
+        uuidv7* begin = first + n * t / thread_count;
+        uuidv7* end = first + n * (t + 1) / thread_count;
+        if (!std::is_sorted(begin, end)) detail::radix_sort_uuids(begin, static_cast<std::size_t>(end - begin));
+        runs[t] = { begin, end };
+    });
+
+    std::vector<uuidv7> merged(first, last);
+    merge_uuids_parallel(runs, merged.data(), thread_count);
+    std::copy(merged.begin(), merged.end(), first);
+}
+
+#if __cpp_lib_span >= 202002L
+/// @brief Sort `uuidv7` values in ascending order with a radix sort
+/// @param uuids UUIDs to sort
+/// @sa sort_uuids(uuidv7*, uuidv7*)
+inline void sort_uuids(std::span<uuidv7> uuids) {
+    sort_uuids(uuids.data(), uuids.data() + uuids.size());
+}
+
+/// @brief Sort `uuidv7` values in ascending order with a radix sort using multiple threads
+/// @param uuids UUIDs to sort
+/// @param thread_count Number of threads (0: `std::thread::hardware_concurrency()`)
+/// @sa sort_uuids_parallel(uuidv7*, uuidv7*, unsigned)
+inline void sort_uuids_parallel(std::span<uuidv7> uuids, unsigned thread_count = 0) {
+    sort_uuids_parallel(uuids.data(), uuids.data() + uuids.size(), thread_count);
+}
+
+/// @brief Merge sorted spans of `uuidv7` values into one sorted sequence
+/// @param runs Sorted input spans
+/// @param out Output buffer (must hold the total number of elements and not overlap the runs)
+/// @return Pointer past the last written element
+/// @sa merge_uuids(const std::vector<uuidv7_run>&, uuidv7*)
+inline uuidv7* merge_uuids(std::span<const std::span<const uuidv7>> runs, uuidv7* out) {
+    std::vector<uuidv7_run> pointer_runs;
+    pointer_runs.reserve(runs.size());
+    for (const auto& run : runs) pointer_runs.emplace_back(run.data(), run.data() + run.size());
+    return merge_uuids(pointer_runs, out);
+}
+
+/// @brief Merge sorted spans of `uuidv7` values into one sorted sequence using multiple threads
+/// @param runs Sorted input spans
+/// @param out Output buffer (must hold the total number of elements and not overlap the runs)
+/// @param thread_count Number of threads (0: `std::thread::hardware_concurrency()`)
+/// @return Pointer past the last written element
+/// @sa merge_uuids_parallel(const std::vector<uuidv7_run>&, uuidv7*, unsigned)
+inline uuidv7* merge_uuids_parallel(std::span<const std::span<const uuidv7>> runs, uuidv7* out, unsigned thread_count = 0) {
+    std::vector<uuidv7_run> pointer_runs;
+    pointer_runs.reserve(runs.size());
+    for (const auto& run : runs) pointer_runs.emplace_back(run.data(), run.data() + run.size());
+    return merge_uuids_parallel(pointer_runs, out, thread_count);
+}
+#endif
+
+} // namespace uuidv7
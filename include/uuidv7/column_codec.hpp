@@ -0,0 +1,269 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+#include "uuidv7.hpp"
+
+namespace uuidv7 {
+
+/// @brief Compact binary encoding for columns of `uuidv7` values
+///
+/// Consecutive UUIDs from a generator share timestamps and usually differ only by a
+/// counter increment, so the column is stored as deltas instead of 16 raw bytes each.
+/// The column is split into blocks of `BLOCK_SIZE` UUIDs; each block starts with a raw
+/// UUID and is followed by one entry per UUID:
+///
+/// | Field | Encoding |
+/// |-------|----------|
+/// | tag | varint: zigzag(timestamp delta) << 1 \| mode |
+/// | counter (mode 1) | varint: counter delta - 1, where the counter is `rand_a:rand_b` (74 bits) |
+/// | counter (mode 0) | 10 raw bytes (the counter was reseeded with random bits) |
+///
+/// A block offset table in the header allows decoding any block independently.
+/// Input in any order round-trips; sorted generator output typically needs 2 bytes per UUID
+/// within a millisecond and 11 bytes at each new millisecond.
+///
+/// | Header | Size |
+/// |--------|------|
+/// | magic `"U7C1"` | 4 |
+/// | UUID count (little-endian) | 8 |
+/// | block size (little-endian) | 4 |
+/// | block count (little-endian) | 4 |
+/// | block offsets relative to the first block (little-endian) | 8 x block count |
+class uuidv7_column_codec {
+public:
+    /// @brief Number of UUIDs per block
+    static constexpr std::size_t BLOCK_SIZE = 128;
+
+    /// @brief Encode a column of UUIDs
+    /// @param first Pointer to the first UUID
+    /// @param last Pointer past the last UUID
+    /// @return Encoded bytes
+    static std::vector<std::uint8_t> encode(const uuidv7* first, const uuidv7* last) {
+        const auto count = static_cast<std::size_t>(last - first);
+        const std::size_t block_count = (count + BLOCK_SIZE - 1) / BLOCK_SIZE;
+
+        std::vector<std::uint8_t> out;
+        out.reserve(HEADER_SIZE + block_count * 8 + count * 3);
+        put_le(out, MAGIC, 4);
+        put_le(out, count, 8);
+        put_le(out, BLOCK_SIZE, 4);
+        put_le(out, block_count, 4);
+        const std::size_t table = out.size();
+        out.resize(table + block_count * 8);
+        const std::size_t blocks = out.size();
+
+        for (std::size_t block = 0; block < block_count; block++) {
+            std::uint64_t offset = out.size() - blocks;
+            for (int i = 0; i < 8; i++) out[table + block * 8 + i] = static_cast<std::uint8_t>(offset >> (i * 8));
+
+            const uuidv7* it = first + block * BLOCK_SIZE;
+            const uuidv7* end = block + 1 == block_count ? last : it + BLOCK_SIZE;
+            const std::array<std::uint8_t, 16> head = it->get_bytes();
+            out.insert(out.end(), head.begin(), head.end());
+
+            for (const uuidv7* prev = it++; it != end; prev = it++) {
+                std::int64_t ts_delta = static_cast<std::int64_t>(it->unix_ts_ms() - prev->unix_ts_ms());
+                std::uint64_t zigzag = (static_cast<std::uint64_t>(ts_delta) << 1) ^ static_cast<std::uint64_t>(ts_delta >> 63);
+                std::uint64_t delta = counter_delta(*prev, *it);
+                if (delta != 0) {
+                    put_varint(out, zigzag << 1 | 1);
+                    put_varint(out, delta - 1);
+                } else {
+                    put_varint(out, zigzag << 1);
+                    const std::array<std::uint8_t, 16> bytes = it->get_bytes();
+                    out.insert(out.end(), bytes.begin() + 6, bytes.end());
+                }
+            }
+        }
+        return out;
+    }
+
+    /// @brief Read-only access to an encoded column
+    ///
+    /// The reader does not copy the encoded bytes; they must outlive the reader.
+    class reader {
+    public:
+        /// @brief Create a reader over encoded bytes
+        /// @param data Pointer to the encoded bytes
+        /// @param size Number of encoded bytes
+        /// @throw invalid_format_error if the header or block offset table is malformed
+        reader(const std::uint8_t* data, std::size_t size) : data_(data), size_(size) {
+            if (size < HEADER_SIZE || get_le(data, 4) != MAGIC)
+                throw invalid_format_error("Invalid uuidv7 column header");
+            const std::uint64_t count = get_le(data + 4, 8);
+            const std::uint64_t block_count = get_le(data + 16, 4);
+            // The encoder always writes BLOCK_SIZE, and every UUID takes at least one byte, so neither
+            // can make a caller size a buffer beyond what the input could encode
+            if (get_le(data + 12, 4) != BLOCK_SIZE || count > size ||
+                block_count != (count + BLOCK_SIZE - 1) / BLOCK_SIZE || (size - HEADER_SIZE) / 8 < block_count)
+                throw invalid_format_error("Invalid uuidv7 column header");
+            count_ = static_cast<std::size_t>(count);
+            block_size_ = BLOCK_SIZE;
+            block_count_ = static_cast<std::size_t>(block_count);
+            blocks_ = HEADER_SIZE + block_count_ * 8;
+            // Each block holds a 16-byte raw UUID, then at least one byte per further UUID
+            if (count_ + 15 * block_count_ > size - blocks_)
+                throw invalid_format_error("Invalid uuidv7 column header");
+        }
+
+        /// @brief Get the number of UUIDs
+        /// @return Number of UUIDs in the column
+        std::size_t size() const noexcept { return count_; }
+        /// @brief Get the number of blocks
+        /// @return Number of blocks in the column
+        std::size_t block_count() const noexcept { return block_count_; }
+        /// @brief Get the number of UUIDs per block
+        /// @return Number of UUIDs per block (the last block may be shorter)
+        std::size_t block_size() const noexcept { return block_size_; }
+
+        /// @brief Decode one block
+        /// @param block Block index
+        /// @param out Output buffer (must hold `block_size()` UUIDs)
+        /// @return Pointer past the last decoded UUID
+        /// @throw std::out_of_range if `block` is out of range
+        /// @throw invalid_format_error if the block data is malformed
+        uuidv7* decode_block(std::size_t block, uuidv7* out) const {
+            return decode_prefix(block, block_length(block), out);
+        }
+
+        /// @brief Decode all blocks
+        /// @param out Output buffer (must hold `size()` UUIDs)
+        /// @return Pointer past the last decoded UUID
+        /// @throw invalid_format_error if the column data is malformed
+        uuidv7* decode_all(uuidv7* out) const {
+            for (std::size_t block = 0; block < block_count_; block++) out = decode_block(block, out);
+            return out;
+        }
+
+        /// @brief Decode a single UUID
+        /// @param index UUID index
+        /// @return `uuidv7` object
+        /// @throw std::out_of_range if `index` is out of range
+        /// @throw invalid_format_error if the block data is malformed
+        /// @note Decodes the block up to `index`; use `decode_block()` for sequential access.
+        uuidv7 at(std::size_t index) const {
+            if (index >= count_) throw std::out_of_range("uuidv7 column index is out of range");
+            const std::size_t block = index / block_size_;
+            const std::size_t position = index % block_size_;
+            uuidv7 result = uuidv7::from_fields(0, 0, 0);
+            decode_prefix(block, position + 1, nullptr, &result);
+            return result;
+        }
+
+    private:
+        const std::uint8_t* data_;
+        std::size_t size_;
+        std::size_t count_ = 0;
+        std::size_t block_size_ = 0;
+        std::size_t block_count_ = 0;
+        std::size_t blocks_ = 0;
+
+        std::size_t block_length(std::size_t block) const {
+            if (block >= block_count_) throw std::out_of_range("uuidv7 column block index is out of range");
+            return block + 1 == block_count_ ? count_ - block * block_size_ : block_size_;
+        }
+
+        /// Decode the first `length` UUIDs of `block` into `out` (or only the last one into `last`)
+        uuidv7* decode_prefix(std::size_t block, std::size_t length, uuidv7* out, uuidv7* last = nullptr) const {
+            const std::uint64_t offset = get_le(data_ + HEADER_SIZE + block * 8, 8);
+            if (offset > size_ - blocks_ || size_ - blocks_ - offset < 16) corrupted();
+            const std::uint8_t* p = data_ + blocks_ + offset;
+            const std::uint8_t* end = data_ + size_;
+
+            uuidv7 prev = uuidv7::from_bytes(p);
+            p += 16;
+            if (out) *out++ = prev;
+            std::uint64_t ts = prev.unix_ts_ms();
+            std::uint16_t rand_a = prev.rand_a();
+            std::uint64_t rand_b = prev.rand_b();
+
+            for (std::size_t i = 1; i < length; i++) {
+                std::uint64_t tag = get_varint(p, end);
+                std::uint64_t zigzag = tag >> 1;
+                ts += (zigzag >> 1) ^ (~(zigzag & 1) + 1);
+                if (tag & 1) {
+                    // Counter delta, carrying from rand_b into rand_a
+                    rand_b += get_varint(p, end) + 1;
+                    while (rand_b > uuidv7::MAX_RAND_B) {
+                        rand_b -= uuidv7::MAX_RAND_B + 1;
+                        rand_a++;
+                    }
+                } else {
+                    if (end - p < 10) corrupted();
+                    rand_a = static_cast<std::uint16_t>(((p[0] & 0x0F) << 8) | p[1]);
+                    rand_b = detail::load_be64(p + 2) & uuidv7::MAX_RAND_B;
+                    p += 10;
+                }
+                if (ts > 0xFFFFFFFFFFFF || rand_a > uuidv7::MAX_RAND_A) corrupted();
+                prev = uuidv7::from_fields(ts, rand_a, rand_b);
+                if (out) *out++ = prev;
+            }
+            if (last) *last = prev;
+            return out;
+        }
+
+        [[noreturn]] static void corrupted() {
+            throw invalid_format_error("Corrupted uuidv7 column data");
+        }
+
+        static std::uint64_t get_varint(const std::uint8_t*& p, const std::uint8_t* end) {
+            std::uint64_t value = 0;
+            for (int shift = 0; shift < 64; shift += 7) {
+                if (p == end) corrupted();
+                std::uint8_t byte = *p++;
+                value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+                if ((byte & 0x80) == 0) return value;
+            }
+            corrupted();
+        }
+    };
+
+    /// @brief Decode a whole column
+    /// @param data Pointer to the encoded bytes
+    /// @param size Number of encoded bytes
+    /// @return Decoded UUIDs
+    /// @throw invalid_format_error if the column data is malformed
+    static std::vector<uuidv7> decode(const std::uint8_t* data, std::size_t size) {
+        reader column(data, size);
+        std::vector<uuidv7> result(column.size(), uuidv7::from_fields(0, 0, 0));
+        column.decode_all(result.data());
+        return result;
+    }
+
+private:
+    static constexpr std::uint32_t MAGIC = 0x31433755; // "U7C1" in little-endian
+    static constexpr std::size_t HEADER_SIZE = 20;
+
+    /// Distance from the counter of `prev` to that of `next` (0 if not strictly increasing within 2^63)
+    static std::uint64_t counter_delta(const uuidv7& prev, const uuidv7& next) noexcept {
+        std::uint16_t prev_a = prev.rand_a(), next_a = next.rand_a();
+        std::uint64_t prev_b = prev.rand_b(), next_b = next.rand_b();
+        if (next_a == prev_a && next_b > prev_b) return next_b - prev_b;
+        if (next_a == prev_a + 1) return (uuidv7::MAX_RAND_B - prev_b) + 1 + next_b;
+        return 0;
+    }
+
+    static void put_le(std::vector<std::uint8_t>& out, std::uint64_t value, int bytes) {
+        for (int i = 0; i < bytes; i++) out.push_back(static_cast<std::uint8_t>(value >> (i * 8)));
+    }
+
+    static std::uint64_t get_le(const std::uint8_t* p, int bytes) noexcept {
+        std::uint64_t value = 0;
+        for (int i = bytes - 1; i >= 0; i--) value = (value << 8) | p[i];
+        return value;
+    }
+
+    static void put_varint(std::vector<std::uint8_t>& out, std::uint64_t value) {
+        while (value >= 0x80) {
+            out.push_back(static_cast<std::uint8_t>(value | 0x80));
+            value >>= 7;
+        }
+        out.push_back(static_cast<std::uint8_t>(value));
+    }
+};
+
+} // namespace uuidv7
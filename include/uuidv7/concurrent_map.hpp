@@ -0,0 +1,312 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include "uuidv7.hpp"
+#include "flat_hash.hpp"
+#include "view.hpp"
+
+namespace uuidv7 {
+
+/// @brief Fixed-capacity concurrent hash map from `uuidv7` to a small trivially copyable `T`
+///
+/// Built for lookup tables read by many threads, such as session registries. Lookups take
+/// no lock and write nothing shared: they are wait-free, finishing within a probe bound that
+/// only grows with the longest insertion. Writers lock one of `WRITE_STRIPES` mutexes chosen
+/// by key, so writers of different keys run concurrently and claim slots by CAS.
+///
+/// Each slot has a 32-bit state word (empty, busy, full or erased, a 7-bit hash fingerprint
+/// and a generation) in a compact array probed linearly, and an entry holding the key words
+/// and the value as atomics. A lookup reads the key and value between two reads of the state,
+/// seqlock style, and ignores a slot that was erased and reused in between. Erased slots are
+/// reused by later insertions; the table never moves, so nothing needs deferred reclamation.
+///
+/// An erased slot cannot simply become empty again, because lookups stop at the first empty
+/// slot and keys further along may have probed past it. Under insert/erase churn the empty
+/// slots would run out and every miss would scan up to the longest probe distance ever seen.
+/// `reclaim()`, run automatically about every `capacity()/4` erases, stops writers, turns
+/// erased slots that no probe sequence crosses back into empty ones, and lowers the probe bound
+/// to the current longest distance. Tombstones inside a probe sequence stay until that key is erased.
+///
+/// `T` is stored in a `std::atomic<T>` that must be lock-free (pointers, indexes, handles).
+/// To map to larger objects, store pointers or indexes into storage owned elsewhere.
+/// @tparam T Mapped type (trivially copyable, lock-free as `std::atomic<T>`)
+/// @tparam Hash Hash function (must spread entropy over all bits, see `uuidv7_flat_hash`)
+template <class T, class Hash = uuidv7_flat_hash>
+class uuidv7_concurrent_map {
+    static_assert(std::is_trivially_copyable<T>::value, "uuidv7_concurrent_map requires a trivially copyable T");
+    static_assert(std::atomic<T>::is_always_lock_free, "uuidv7_concurrent_map requires a lock-free std::atomic<T>");
+
+public:
+    /// @brief Mapped type
+    using mapped_type = T;
+    /// @brief Number of writer lock stripes
+    static constexpr std::size_t WRITE_STRIPES = 64;
+
+    /// @brief Create an empty map
+    /// @param capacity Maximum number of entries; the table is sized to stay at most 7/8 full
+    explicit uuidv7_concurrent_map(std::size_t capacity) : capacity_(capacity) {
+        std::size_t slots = 16;
+        while (slots - slots / 8 < capacity) slots *= 2;
+        mask_ = slots - 1;
+        states_.reset(new std::atomic<std::uint32_t>[slots]);
+        entries_.reset(new entry[slots]);
+        for (std::size_t i = 0; i < slots; i++) states_[i].store(EMPTY, std::memory_order_relaxed);
+    }
+
+    uuidv7_concurrent_map(const uuidv7_concurrent_map&) = delete;
+    uuidv7_concurrent_map& operator=(const uuidv7_concurrent_map&) = delete;
+
+    /// @brief Look up the value of a UUID (wait-free)
+    /// @param uuid UUID to search
+    /// @return Value, or `std::nullopt` if the UUID is not in the map
+    std::optional<T> find(const uuidv7& uuid) const noexcept {
+        T value;
+        if (load(uuid, value)) return value;
+        return std::nullopt;
+    }
+
+    /// @brief Check whether a UUID is in the map (wait-free)
+    /// @param uuid UUID to search
+    /// @return `true` if the UUID is in the map
+    bool contains(const uuidv7& uuid) const noexcept {
+        T value;
+        return load(uuid, value);
+    }
+
+    /// @brief Insert a UUID unless it is already in the map
+    /// @param uuid UUID to insert
+    /// @param value Value to store
+    /// @return `true` if inserted; `false` if the UUID was already in the map (its value is kept)
+    /// @throw std::length_error if the map already holds `capacity()` entries
+    bool insert(const uuidv7& uuid, T value) { return store(uuid, value, false); }
+
+    /// @brief Insert a UUID or replace its value
+    /// @param uuid UUID to insert
+    /// @param value Value to store
+    /// @return `true` if inserted; `false` if the value of an existing entry was replaced
+    /// @throw std::length_error if the UUID is new and the map already holds `capacity()` entries
+    bool insert_or_assign(const uuidv7& uuid, T value) { return store(uuid, value, true); }
+
+    /// @brief Erase a UUID
+    /// @param uuid UUID to erase
+    /// @return Number of erased entries (0 or 1)
+    std::size_t erase(const uuidv7& uuid) noexcept {
+        {
+            const key k(uuid);
+            std::lock_guard<std::mutex> lock(stripe(k.hash));
+            const std::size_t i = find_locked(k);
+            if (i == NPOS) return 0;
+            const std::uint32_t state = states_[i].load(std::memory_order_relaxed);
+            states_[i].store(next_generation(state) | ERASED, std::memory_order_release);
+            size_.fetch_sub(1, std::memory_order_relaxed);
+        }
+        // One eraser in each round of capacity()/4 erases pays for the reclamation
+        const std::size_t period = capacity_ / 4 + 1;
+        if (erases_.fetch_add(1, std::memory_order_relaxed) % period == period - 1) reclaim();
+        return 1;
+    }
+
+    /// @brief Turn erased slots back into empty slots where no lookup needs to probe past them
+    ///
+    /// Locks out all writers for one pass over the table; lookups keep running.
+    /// Called automatically by `erase()`, so calling it is only needed after bursts of erases.
+    /// @return Number of reclaimed slots
+    std::size_t reclaim() noexcept {
+        // Stripes are always taken in the same order, so concurrent reclaims cannot deadlock
+        for (padded_mutex& m : stripes_) m.mutex.lock();
+        // Scan backwards twice around the table: `covered` counts the slots before the current one
+        // that some key probed through. The first lap only carries the coverage across the wrap.
+        const std::size_t slots = mask_ + 1;
+        std::size_t covered = 0, longest = 0, reclaimed = 0;
+        for (std::size_t n = 2 * slots; n-- > 0;) {
+            const std::size_t i = n & mask_;
+            const std::uint32_t state = states_[i].load(std::memory_order_relaxed);
+            const bool crossed = covered > 0;
+            if (crossed) covered--;
+            if ((state & KIND_MASK) == FULL) {
+                const std::size_t distance = (i - home_of(i)) & mask_;
+                if (distance > covered) covered = distance;
+                if (n < slots && distance > longest) longest = distance;
+            } else if ((state & KIND_MASK) == ERASED && !crossed && n < slots) {
+                states_[i].store(next_generation(state) | EMPTY, std::memory_order_release);
+                reclaimed++;
+            }
+        }
+        max_probe_.store(longest, std::memory_order_seq_cst);
+        for (padded_mutex& m : stripes_) m.mutex.unlock();
+        return reclaimed;
+    }
+
+    /// @brief Visit the entries (weakly consistent with concurrent writers)
+    ///
+    /// Entries inserted or erased during the visit may or may not be visited.
+    /// @param callback Called as `callback(const uuidv7&, T)` for each entry
+    template <class Callback>
+    void for_each(Callback&& callback) const {
+        for (std::size_t i = 0; i <= mask_; i++) {
+            const std::uint32_t state = states_[i].load(std::memory_order_acquire);
+            if ((state & KIND_MASK) != FULL) continue;
+            std::uint64_t words[2];
+            T value;
+            if (read_entry(i, state, words, value)) {
+                std::uint8_t bytes[16];
+                std::memcpy(bytes, words, 16);
+                callback(uuidv7::from_bytes_unchecked(bytes), value);
+            }
+        }
+    }
+
+    /// @brief Get the number of entries
+    /// @return Number of entries (approximate while writers are active)
+    std::size_t size() const noexcept { return size_.load(std::memory_order_relaxed); }
+    /// @brief Check whether the map is empty
+    /// @return `true` if the map has no entries
+    bool empty() const noexcept { return size() == 0; }
+    /// @brief Get the maximum number of entries
+    /// @return Capacity given at construction
+    std::size_t capacity() const noexcept { return capacity_; }
+
+private:
+    static constexpr std::size_t NPOS = ~std::size_t(0);
+
+    // State word: kind (2 bits), fingerprint (7 bits), generation (23 bits, bumped on erase and reclaim,
+    // so a slot emptied and reused during a lookup never looks unchanged)
+    static constexpr std::uint32_t EMPTY = 0;
+    static constexpr std::uint32_t BUSY = 1;
+    static constexpr std::uint32_t FULL = 2;
+    static constexpr std::uint32_t ERASED = 3;
+    static constexpr std::uint32_t KIND_MASK = 3;
+    static constexpr std::uint32_t TAG_MASK = 0x1FF;
+    static constexpr std::uint32_t GENERATION_ONE = 0x200;
+
+    struct entry {
+        std::atomic<std::uint64_t> words[2];
+        std::atomic<T> value;
+    };
+
+    struct alignas(64) padded_mutex {
+        std::mutex mutex;
+    };
+
+    /// Probe key: the UUID bytes as two native words, its hash and the tag of its full state
+    struct key {
+        std::uint64_t words[2];
+        std::size_t hash;
+        std::uint32_t tag;
+
+        explicit key(const uuidv7& uuid) noexcept : hash(Hash()(uuid)) {
+            std::memcpy(words, uuidv7_view(uuid).data(), 16);
+            tag = FULL | static_cast<std::uint32_t>(hash >> (sizeof(std::size_t) * 8 - 7)) << 2;
+        }
+    };
+
+    std::size_t capacity_;
+    std::size_t mask_;
+    std::unique_ptr<std::atomic<std::uint32_t>[]> states_;
+    std::unique_ptr<entry[]> entries_;
+    std::atomic<std::size_t> size_{0};
+    /// Longest distance from the home slot of any insertion; lookups never probe further
+    std::atomic<std::size_t> max_probe_{0};
+    std::atomic<std::size_t> erases_{0};
+    padded_mutex stripes_[WRITE_STRIPES];
+
+    static std::uint32_t next_generation(std::uint32_t state) noexcept {
+        return (state & ~TAG_MASK) + GENERATION_ONE;
+    }
+
+    std::mutex& stripe(std::size_t hash) noexcept { return stripes_[(hash >> 16) % WRITE_STRIPES].mutex; }
+
+    /// Home slot of the key in full slot `i` (writers must be locked out)
+    std::size_t home_of(std::size_t i) const noexcept {
+        std::uint8_t bytes[16];
+        const std::uint64_t words[2] = { entries_[i].words[0].load(std::memory_order_relaxed),
+                                         entries_[i].words[1].load(std::memory_order_relaxed) };
+        std::memcpy(bytes, words, 16);
+        return Hash()(uuidv7::from_bytes_unchecked(bytes)) & mask_;
+    }
+
+    /// Read the key and value of slot `i`, which was seen in `state`; fails if the slot changed meanwhile
+    bool read_entry(std::size_t i, std::uint32_t state, std::uint64_t* words, T& value) const noexcept {
+        const entry& e = entries_[i];
+        // Acquire loads keep the state check after them, and see the busy state of any writer they read from
+        words[0] = e.words[0].load(std::memory_order_acquire);
+        words[1] = e.words[1].load(std::memory_order_acquire);
+        value = e.value.load(std::memory_order_acquire);
+        return states_[i].load(std::memory_order_relaxed) == state;
+    }
+
+    bool load(const uuidv7& uuid, T& value) const noexcept {
+        const key k(uuid);
+        const std::size_t limit = max_probe_.load(std::memory_order_seq_cst);
+        std::size_t i = k.hash & mask_;
+        for (std::size_t distance = 0; distance <= limit; distance++, i = (i + 1) & mask_) {
+            const std::uint32_t state = states_[i].load(std::memory_order_acquire);
+            if ((state & KIND_MASK) == EMPTY) return false;
+            if ((state & TAG_MASK) != k.tag) continue;
+            std::uint64_t words[2];
+            // A slot reused during the read belongs to a concurrent erase or insert; skipping it is a valid outcome
+            if (read_entry(i, state, words, value) && words[0] == k.words[0] && words[1] == k.words[1]) return true;
+        }
+        return false;
+    }
+
+    /// Slot of a key while holding its stripe (no other writer can insert or erase the same key)
+    std::size_t find_locked(const key& k) const noexcept {
+        const std::size_t limit = max_probe_.load(std::memory_order_relaxed);
+        std::size_t i = k.hash & mask_;
+        for (std::size_t distance = 0; distance <= limit; distance++, i = (i + 1) & mask_) {
+            const std::uint32_t state = states_[i].load(std::memory_order_acquire);
+            if ((state & KIND_MASK) == EMPTY) break;
+            if ((state & TAG_MASK) != k.tag) continue;
+            // Writers of other keys may reuse a slot meanwhile, but only this writer can change the slot of `k`
+            std::uint64_t words[2];
+            T value;
+            if (read_entry(i, state, words, value) && words[0] == k.words[0] && words[1] == k.words[1]) return i;
+        }
+        return NPOS;
+    }
+
+    bool store(const uuidv7& uuid, T value, bool assign) {
+        const key k(uuid);
+        std::lock_guard<std::mutex> lock(stripe(k.hash));
+        const std::size_t found = find_locked(k);
+        if (found != NPOS) {
+            if (assign) entries_[found].value.store(value, std::memory_order_release);
+            return false;
+        }
+        if (size_.fetch_add(1, std::memory_order_relaxed) >= capacity_) {
+            size_.fetch_sub(1, std::memory_order_relaxed);
+            throw std::length_error("uuidv7_concurrent_map is full");
+        }
+
+        // Claim the first empty or erased slot; other writers may race for the same slot
+        std::size_t i = k.hash & mask_;
+        for (std::size_t distance = 0;; distance++, i = (i + 1) & mask_) {
+            std::uint32_t state = states_[i].load(std::memory_order_relaxed);
+            const std::uint32_t kind = state & KIND_MASK;
+            if ((kind != EMPTY && kind != ERASED) ||
+                !states_[i].compare_exchange_strong(state, (state & ~TAG_MASK) | BUSY, std::memory_order_relaxed))
+                continue;
+            // Seqlock write: release stores order the busy state before the new key and value
+            entry& e = entries_[i];
+            e.words[0].store(k.words[0], std::memory_order_release);
+            e.words[1].store(k.words[1], std::memory_order_release);
+            e.value.store(value, std::memory_order_release);
+
+            std::size_t probe = max_probe_.load(std::memory_order_relaxed);
+            while (probe < distance && !max_probe_.compare_exchange_weak(probe, distance, std::memory_order_seq_cst)) {}
+            states_[i].store((state & ~TAG_MASK) | k.tag, std::memory_order_release);
+            return true;
+        }
+    }
+};
+
+} // namespace uuidv7
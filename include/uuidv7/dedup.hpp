@@ -0,0 +1,125 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+#include "uuidv7.hpp"
+#include "flat_hash.hpp"
+
+namespace uuidv7 {
+
+/// @brief Duplicate filter remembering the `uuidv7` seen within a sliding time window
+///
+/// UUIDs are bucketed by the time slot of their embedded timestamp into a ring of
+/// `uuidv7_flat_set`, one per slot. A UUID can only ever land in the bucket of its own
+/// slot, so inserting or checking one is a single hash lookup. The window follows the
+/// newest timestamp seen (or `advance_to()`), and buckets that fall out of it are
+/// cleared whole, so memory stays bounded without any per-entry expiry bookkeeping.
+///
+/// Every UUID whose timestamp is within `window` of the newest one is remembered. UUIDs
+/// older than the retained slots are reported as `status::expired` instead of being
+/// checked, since a duplicate of them may already have been forgotten.
+class uuidv7_dedup_window {
+public:
+    /// @brief Outcome of `insert()`
+    enum class status : std::uint8_t {
+        inserted,  ///< First occurrence within the window; now remembered
+        duplicate, ///< Already seen within the window
+        expired,   ///< Older than the window; cannot be checked
+    };
+
+    /// @brief Create an empty filter
+    /// @param window Minimum time a UUID is remembered, measured from the newest timestamp
+    /// @param slot Time slot per bucket (default: 1 second); memory is released in steps of `slot`
+    /// @throw std::invalid_argument if `window` is negative or `slot` is not positive
+    explicit uuidv7_dedup_window(std::chrono::milliseconds window, std::chrono::milliseconds slot = std::chrono::seconds(1))
+        : window_(window), slot_ms_(static_cast<std::uint64_t>(slot.count()))
+    {
+        if (window.count() < 0) throw std::invalid_argument("Dedup window must not be negative");
+        if (slot.count() <= 0) throw std::invalid_argument("Dedup slot must be positive");
+        // Slots from floor((newest - window) / slot) to floor(newest / slot)
+        const std::uint64_t slots = (static_cast<std::uint64_t>(window.count()) + slot_ms_ - 1) / slot_ms_ + 1;
+        buckets_.resize(static_cast<std::size_t>(slots));
+        tags_.resize(static_cast<std::size_t>(slots), NO_SLOT);
+    }
+
+    /// @brief Insert a UUID unless it was seen within the window
+    /// @param uuid UUID to insert
+    /// @return `status::inserted`, `status::duplicate` or `status::expired`
+    status insert(const uuidv7& uuid) {
+        const std::uint64_t slot = uuid.unix_ts_ms() / slot_ms_;
+        if (head_ == NO_SLOT || slot > head_) advance(slot);
+        else if (head_ - slot >= buckets_.size()) return status::expired;
+
+        const std::size_t index = static_cast<std::size_t>(slot % buckets_.size());
+        tags_[index] = slot;
+        return buckets_[index].insert(uuid).second ? status::inserted : status::duplicate;
+    }
+
+    /// @brief Check whether a UUID was seen within the window
+    /// @param uuid UUID to search
+    /// @return `true` if the UUID is remembered
+    bool contains(const uuidv7& uuid) const noexcept {
+        const std::uint64_t slot = uuid.unix_ts_ms() / slot_ms_;
+        const std::size_t index = static_cast<std::size_t>(slot % buckets_.size());
+        return tags_[index] == slot && buckets_[index].contains(uuid);
+    }
+
+    /// @brief Move the window forward to a time point, e.g. the wall clock during idle periods
+    /// @param now Time point; earlier than the newest timestamp seen has no effect
+    /// @throw std::out_of_range if `now` is out of the UUID Version 7 timestamp range
+    template <class Duration>
+    void advance_to(std::chrono::time_point<std::chrono::system_clock, Duration> now) {
+        const std::uint64_t slot = uuidv7::min_for_time(now).unix_ts_ms() / slot_ms_;
+        if (head_ == NO_SLOT || slot > head_) advance(slot);
+    }
+
+    /// @brief Get the number of remembered UUIDs
+    /// @return Number of UUIDs within the window
+    std::size_t size() const noexcept {
+        std::size_t count = 0;
+        for (const auto& bucket : buckets_) count += bucket.size();
+        return count;
+    }
+
+    /// @brief Remove all UUIDs and reset the window
+    void clear() noexcept {
+        for (auto& bucket : buckets_) bucket.clear();
+        for (auto& tag : tags_) tag = NO_SLOT;
+        head_ = NO_SLOT;
+    }
+
+    /// @brief Get the window
+    /// @return Minimum time a UUID is remembered
+    std::chrono::milliseconds window() const noexcept { return window_; }
+
+private:
+    static constexpr std::uint64_t NO_SLOT = ~std::uint64_t(0);
+
+    std::chrono::milliseconds window_;
+    std::uint64_t slot_ms_;
+    std::vector<uuidv7_flat_set<>> buckets_;
+    std::vector<std::uint64_t> tags_;
+    std::uint64_t head_ = NO_SLOT;
+
+    /// Make `slot` the newest slot, dropping the buckets that fall out of the window
+    void advance(std::uint64_t slot) noexcept {
+        const std::uint64_t count = buckets_.size();
+        // Only the buckets of the slots entering the window are reused
+        const std::uint64_t first = (head_ == NO_SLOT || slot - head_ >= count) ? slot - std::min(slot, count - 1) : head_ + 1;
+        for (std::uint64_t t = first; t <= slot; t++) {
+            const std::size_t index = static_cast<std::size_t>(t % count);
+            if (tags_[index] != NO_SLOT) {
+                // The table keeps its capacity for the new slot
+                buckets_[index].clear();
+                tags_[index] = NO_SLOT;
+            }
+        }
+        head_ = slot;
+    }
+};
+
+} // namespace uuidv7
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstdint>
+#if __has_include(<version>)
+    #include <version>
+#endif
+
+#if __cpp_lib_bitops >= 201907L
+    #include <bit>
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    /// Defined when the compiler targets SSE2, which the bulk paths use as their baseline
+    #define UUIDV7LIB_SSE2
+#endif
+
+namespace uuidv7 {
+
+/// @cond Doxygen_suppress
+namespace detail {
+    /// Index of the lowest set bit of `value`, 64 when `value` is 0
+    inline unsigned count_trailing_zeros(std::uint64_t value) noexcept {
+#if __cpp_lib_bitops >= 201907L
+        return static_cast<unsigned>(std::countr_zero(value));
+#elif defined(__GNUC__) || defined(__clang__)
+        return value ? static_cast<unsigned>(__builtin_ctzll(value)) : 64;
+#else
+        unsigned count = 0;
+        while (count < 64 && !(value & 1)) {
+            value >>= 1;
+            count++;
+        }
+        return count;
+#endif
+    }
+
+    /// Number of set bits in `value`
+    inline unsigned popcount(std::uint64_t value) noexcept {
+#if __cpp_lib_bitops >= 201907L
+        return static_cast<unsigned>(std::popcount(value));
+#elif defined(__GNUC__) || defined(__clang__)
+        return static_cast<unsigned>(__builtin_popcountll(value));
+#else
+        unsigned count = 0;
+        for (; value; value &= value - 1) count++;
+        return count;
+#endif
+    }
+} // namespace detail
+/// @endcond
+
+} // namespace uuidv7
@@ -0,0 +1,449 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+#include "uuidv7.hpp"
+#include "view.hpp"
+#include "detail/bits.hpp"
+
+#if defined(__AVX2__)
+    #include <immintrin.h>
+#endif
+
+namespace uuidv7 {
+
+/// @cond Doxygen_suppress
+namespace detail {
+    inline std::uint32_t load_le32(const std::uint8_t* p) noexcept {
+        return static_cast<std::uint32_t>(p[0]) | static_cast<std::uint32_t>(p[1]) << 8 |
+               static_cast<std::uint32_t>(p[2]) << 16 | static_cast<std::uint32_t>(p[3]) << 24;
+    }
+
+    inline void store_le32(std::uint8_t* p, std::uint32_t value) noexcept {
+        for (int i = 0; i < 4; i++) p[i] = static_cast<std::uint8_t>(value >> (i * 8));
+    }
+
+    inline std::uint64_t load_le64(const std::uint8_t* p) noexcept {
+        return static_cast<std::uint64_t>(load_le32(p)) | static_cast<std::uint64_t>(load_le32(p + 4)) << 32;
+    }
+
+    inline void store_le64(std::uint8_t* p, std::uint64_t value) noexcept {
+        store_le32(p, static_cast<std::uint32_t>(value));
+        store_le32(p + 4, static_cast<std::uint32_t>(value >> 32));
+    }
+
+    /// Size of the serialized filter header; keeps the blocks 32-byte aligned in a mapped file
+    constexpr std::size_t FILTER_HEADER_SIZE = 64;
+    /// Size of a Bloom filter block (8 words of 32 bits)
+    constexpr std::size_t BLOOM_BLOCK_SIZE = 32;
+    constexpr std::uint32_t BLOOM_MAGIC = 0x31423755; // "U7B1" in little-endian
+    constexpr std::uint32_t CUCKOO_MAGIC = 0x31513755; // "U7Q1" in little-endian
+    constexpr std::uint32_t FILTER_LAYOUT = 1;
+
+    /// Odd multipliers selecting one bit in each word of a block (as in the Parquet split block Bloom filter)
+    constexpr std::uint32_t BLOOM_SALT[8] = {0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+                                            0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+
+    /// Offset of the block of a hash: the high 32 bits are mapped onto `[0, block_count)` without a division
+    inline std::size_t bloom_block(std::size_t block_count, std::uint64_t hash) noexcept {
+        return static_cast<std::size_t>(((hash >> 32) * block_count) >> 32) * BLOOM_BLOCK_SIZE;
+    }
+
+#if defined(__AVX2__)
+    /// The 8 bits selected by the low 32 bits of a hash, one per word of a block
+    inline __m256i bloom_mask(std::uint32_t key) noexcept {
+        const __m256i salt = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(BLOOM_SALT));
+        __m256i shift = _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_set1_epi32(static_cast<int>(key)), salt), 27);
+        return _mm256_sllv_epi32(_mm256_set1_epi32(1), shift);
+    }
+#elif defined(UUIDV7LIB_SSE2)
+    /// The bits selected by the low 32 bits of a hash in words `4 * half` to `4 * half + 3` of a block.
+    /// SSE2 has neither 32-bit multiplies nor variable shifts: the products come from two 32x32->64
+    /// multiplies, and `1 << n` is the float `2^n` (exponent `n + 127`) converted back to an integer,
+    /// where `2^31` converts to `0x80000000` as well.
+    inline __m128i bloom_mask(std::uint32_t key, int half) noexcept {
+        const __m128i k = _mm_set1_epi32(static_cast<int>(key));
+        const std::uint32_t* salt = BLOOM_SALT + half * 4;
+        __m128i even = _mm_mul_epu32(k, _mm_setr_epi32(static_cast<int>(salt[0]), 0, static_cast<int>(salt[2]), 0));
+        __m128i odd = _mm_mul_epu32(k, _mm_setr_epi32(static_cast<int>(salt[1]), 0, static_cast<int>(salt[3]), 0));
+        __m128i product = _mm_unpacklo_epi32(_mm_shuffle_epi32(even, 0x08), _mm_shuffle_epi32(odd, 0x08));
+        __m128i exponent = _mm_slli_epi32(_mm_add_epi32(_mm_srli_epi32(product, 27), _mm_set1_epi32(127)), 23);
+        return _mm_cvttps_epi32(_mm_castsi128_ps(exponent));
+    }
+#endif
+
+    /// Check the 8 bits selected by the low 32 bits of a hash, one per word of the block
+    inline bool bloom_block_contains(const std::uint8_t* block, std::uint32_t key) noexcept {
+#if defined(__AVX2__)
+        return _mm256_testc_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(block)), bloom_mask(key)) != 0;
+#elif defined(UUIDV7LIB_SSE2)
+        const __m128i* words = reinterpret_cast<const __m128i*>(block);
+        __m128i lo = bloom_mask(key, 0), hi = bloom_mask(key, 1);
+        __m128i missing = _mm_or_si128(_mm_andnot_si128(_mm_loadu_si128(words), lo),
+                                       _mm_andnot_si128(_mm_loadu_si128(words + 1), hi));
+        return _mm_movemask_epi8(_mm_cmpeq_epi32(missing, _mm_setzero_si128())) == 0xFFFF;
+#else
+        std::uint32_t missing = 0;
+        for (int i = 0; i < 8; i++)
+            missing |= ~load_le32(block + i * 4) & (1U << ((key * BLOOM_SALT[i]) >> 27));
+        return missing == 0;
+#endif
+    }
+
+    inline void bloom_block_insert(std::uint8_t* block, std::uint32_t key) noexcept {
+#if defined(__AVX2__)
+        __m256i* words = reinterpret_cast<__m256i*>(block);
+        _mm256_storeu_si256(words, _mm256_or_si256(_mm256_loadu_si256(words), bloom_mask(key)));
+#elif defined(UUIDV7LIB_SSE2)
+        __m128i* words = reinterpret_cast<__m128i*>(block);
+        _mm_storeu_si128(words, _mm_or_si128(_mm_loadu_si128(words), bloom_mask(key, 0)));
+        _mm_storeu_si128(words + 1, _mm_or_si128(_mm_loadu_si128(words + 1), bloom_mask(key, 1)));
+#else
+        for (int i = 0; i < 8; i++)
+            store_le32(block + i * 4, load_le32(block + i * 4) | (1U << ((key * BLOOM_SALT[i]) >> 27)));
+#endif
+    }
+
+    /// Validate a serialized Bloom filter and get its block count
+    inline std::size_t bloom_block_count(const std::uint8_t* data, std::size_t size) {
+        if (size < FILTER_HEADER_SIZE || load_le32(data) != BLOOM_MAGIC || load_le32(data + 4) != FILTER_LAYOUT)
+            throw invalid_format_error("Invalid uuidv7 Bloom filter header");
+        const std::uint64_t block_count = load_le64(data + 8);
+        if (block_count == 0 || block_count > 0xFFFFFFFFU ||
+            size - FILTER_HEADER_SIZE != block_count * BLOOM_BLOCK_SIZE)
+            throw invalid_format_error("Invalid uuidv7 Bloom filter header");
+        return static_cast<std::size_t>(block_count);
+    }
+
+    constexpr std::uint64_t CUCKOO_LANES = 0x0001000100010001ULL;
+
+    /// Bit 15 of each 16-bit lane that is zero (lanes above the first zero one may also be flagged)
+    constexpr std::uint64_t cuckoo_zero_lanes(std::uint64_t v) noexcept {
+        return (v - CUCKOO_LANES) & ~v & (CUCKOO_LANES << 15);
+    }
+} // namespace detail
+/// @endcond
+
+/// @brief Read-only view of a serialized `uuidv7_bloom_filter`, e.g. in a memory-mapped file
+///
+/// The view reads the serialized bytes in place; they must outlive the view.
+class uuidv7_bloom_filter_view {
+public:
+    /// @brief Create a view over serialized bytes
+    /// @param data Pointer to the bytes from `uuidv7_bloom_filter::bytes()`
+    /// @param size Number of bytes
+    /// @throw invalid_format_error if the bytes are not a serialized Bloom filter
+    uuidv7_bloom_filter_view(const std::uint8_t* data, std::size_t size)
+        : block_count_(detail::bloom_block_count(data, size)), blocks_(data + detail::FILTER_HEADER_SIZE) {}
+
+    /// @brief Check whether a UUID may have been inserted
+    /// @param uuid UUID to check
+    /// @return `false` if the UUID was never inserted; `true` if it probably was
+    bool contains(const uuidv7& uuid) const noexcept {
+        const std::uint64_t hash = detail::mix_hash_bytes(uuidv7_view(uuid).data());
+        return detail::bloom_block_contains(blocks_ + detail::bloom_block(block_count_, hash), static_cast<std::uint32_t>(hash));
+    }
+
+    /// @brief Get the number of 32-byte blocks
+    /// @return Number of blocks
+    std::size_t block_count() const noexcept { return block_count_; }
+
+private:
+    std::size_t block_count_;
+    const std::uint8_t* blocks_;
+};
+
+/// @brief Split block Bloom filter of `uuidv7` for cheap negative lookups
+///
+/// Each UUID sets 8 bits in a single 32-byte block (one bit per 32-bit word), so a lookup
+/// touches one cache line and checks the 8 bits at once (with SSE2 or AVX2, whichever
+/// the compiler targets). At 10 bits per key the false positive rate is about 1%.
+///
+/// The filter is held in its serialized form: `bytes()` can be written to a file as is and
+/// read back with `from_bytes()`, or mapped and queried in place with `uuidv7_bloom_filter_view`.
+///
+/// | Section | Layout |
+/// |---------|--------|
+/// | header (64 bytes) | magic `"U7B1"`, layout (4 bytes), block count (8 bytes), zero padding (little-endian) |
+/// | blocks | 8 x 32-bit words each (little-endian) |
+class uuidv7_bloom_filter {
+public:
+    /// @brief Create an empty filter
+    /// @param expected_count Expected number of UUIDs
+    /// @param bits_per_key Filter bits per expected UUID (default: 10, about 1% false positives)
+    /// @throw std::invalid_argument if `bits_per_key` is zero or the filter would exceed 2^32 blocks
+    explicit uuidv7_bloom_filter(std::size_t expected_count, std::size_t bits_per_key = 10) {
+        if (bits_per_key == 0) throw std::invalid_argument("Bloom filter bits per key must be positive");
+        const std::uint64_t bits = static_cast<std::uint64_t>(expected_count) * bits_per_key;
+        std::uint64_t block_count = (bits + detail::BLOOM_BLOCK_SIZE * 8 - 1) / (detail::BLOOM_BLOCK_SIZE * 8);
+        if (block_count == 0) block_count = 1;
+        if (block_count > 0xFFFFFFFFU) throw std::invalid_argument("Bloom filter is too large");
+        bytes_.resize(detail::FILTER_HEADER_SIZE + static_cast<std::size_t>(block_count) * detail::BLOOM_BLOCK_SIZE);
+        detail::store_le32(bytes_.data(), detail::BLOOM_MAGIC);
+        detail::store_le32(bytes_.data() + 4, detail::FILTER_LAYOUT);
+        detail::store_le64(bytes_.data() + 8, block_count);
+    }
+
+    /// @brief Load a filter from serialized bytes
+    /// @param data Pointer to the bytes from `bytes()`
+    /// @param size Number of bytes
+    /// @return Copy of the serialized filter
+    /// @throw invalid_format_error if the bytes are not a serialized Bloom filter
+    static uuidv7_bloom_filter from_bytes(const std::uint8_t* data, std::size_t size) {
+        detail::bloom_block_count(data, size);
+        uuidv7_bloom_filter filter;
+        filter.bytes_.assign(data, data + size);
+        return filter;
+    }
+
+    /// @brief Insert a UUID
+    /// @param uuid UUID to insert
+    void insert(const uuidv7& uuid) noexcept {
+        const std::uint64_t hash = detail::mix_hash_bytes(uuidv7_view(uuid).data());
+        std::uint8_t* blocks = bytes_.data() + detail::FILTER_HEADER_SIZE;
+        detail::bloom_block_insert(blocks + detail::bloom_block(block_count(), hash), static_cast<std::uint32_t>(hash));
+    }
+
+    /// @brief Check whether a UUID may have been inserted
+    /// @param uuid UUID to check
+    /// @return `false` if the UUID was never inserted; `true` if it probably was
+    bool contains(const uuidv7& uuid) const noexcept {
+        const std::uint64_t hash = detail::mix_hash_bytes(uuidv7_view(uuid).data());
+        const std::uint8_t* blocks = bytes_.data() + detail::FILTER_HEADER_SIZE;
+        return detail::bloom_block_contains(blocks + detail::bloom_block(block_count(), hash), static_cast<std::uint32_t>(hash));
+    }
+
+    /// @brief Remove all UUIDs
+    void clear() noexcept { std::fill(bytes_.begin() + detail::FILTER_HEADER_SIZE, bytes_.end(), std::uint8_t(0)); }
+
+    /// @brief Get the number of 32-byte blocks
+    /// @return Number of blocks
+    std::size_t block_count() const noexcept {
+        return (bytes_.size() - detail::FILTER_HEADER_SIZE) / detail::BLOOM_BLOCK_SIZE;
+    }
+
+    /// @brief Get the serialized filter
+    /// @return Serialized bytes, valid until the filter is modified or destroyed
+    const std::vector<std::uint8_t>& bytes() const noexcept { return bytes_; }
+
+    /// @brief Get a read-only view of the filter
+    /// @return View valid until the filter is destroyed
+    uuidv7_bloom_filter_view view() const { return uuidv7_bloom_filter_view(bytes_.data(), bytes_.size()); }
+
+private:
+    std::vector<std::uint8_t> bytes_;
+
+    uuidv7_bloom_filter() = default;
+};
+
+/// @brief Cuckoo filter of `uuidv7` supporting deletion
+///
+/// Each UUID is stored as a 16-bit fingerprint in one of two buckets of 4 fingerprints.
+/// A bucket is a 64-bit word, and a lookup compares the fingerprint with the 4 lanes of
+/// both buckets at once without branching per slot. The false positive rate is about
+/// 0.012%, and the filter fills up to about 95% of `capacity()`.
+///
+/// Only UUIDs that were inserted may be erased; erasing any other UUID may remove the
+/// fingerprint of a different UUID. Inserting the same UUID twice stores it twice.
+///
+/// | Section | Layout |
+/// |---------|--------|
+/// | header (64 bytes) | magic `"U7Q1"`, layout (4 bytes), bucket count, size, victim index (8 bytes each), victim fingerprint (2 bytes), zero padding (little-endian) |
+/// | buckets | 4 x 16-bit fingerprints each (little-endian) |
+class uuidv7_cuckoo_filter {
+public:
+    /// @brief Number of fingerprints per bucket
+    static constexpr std::size_t BUCKET_SIZE = 4;
+
+    /// @brief Create an empty filter
+    /// @param expected_count Expected number of UUIDs
+    explicit uuidv7_cuckoo_filter(std::size_t expected_count) {
+        // Round the buckets needed at a 95% load up to a power of two
+        const std::size_t needed = static_cast<std::size_t>(static_cast<double>(expected_count) / 0.95 / BUCKET_SIZE) + 1;
+        std::size_t bucket_count = 2;
+        while (bucket_count < needed) bucket_count *= 2;
+        buckets_.assign(bucket_count, 0);
+    }
+
+    /// @brief Load a filter from serialized bytes
+    /// @param data Pointer to the bytes from `to_bytes()`
+    /// @param size Number of bytes
+    /// @return Loaded filter
+    /// @throw invalid_format_error if the bytes are not a serialized cuckoo filter
+    static uuidv7_cuckoo_filter from_bytes(const std::uint8_t* data, std::size_t size) {
+        if (size < detail::FILTER_HEADER_SIZE || detail::load_le32(data) != detail::CUCKOO_MAGIC ||
+            detail::load_le32(data + 4) != detail::FILTER_LAYOUT)
+            throw invalid_format_error("Invalid uuidv7 cuckoo filter header");
+        const std::uint64_t bucket_count = detail::load_le64(data + 8);
+        uuidv7_cuckoo_filter filter;
+        filter.size_ = static_cast<std::size_t>(detail::load_le64(data + 16));
+        filter.victim_index_ = static_cast<std::size_t>(detail::load_le64(data + 24));
+        filter.victim_ = static_cast<std::uint16_t>(data[32] | data[33] << 8);
+        if (bucket_count < 2 || (bucket_count & (bucket_count - 1)) != 0 ||
+            (size - detail::FILTER_HEADER_SIZE) % 8 != 0 || (size - detail::FILTER_HEADER_SIZE) / 8 != bucket_count ||
+            filter.victim_index_ >= bucket_count)
+            throw invalid_format_error("Invalid uuidv7 cuckoo filter header");
+        filter.buckets_.resize(static_cast<std::size_t>(bucket_count));
+        // The size must match the stored fingerprints, or erase() would underflow it
+        std::size_t occupied = filter.victim_ != 0;
+        for (std::size_t i = 0; i < filter.buckets_.size(); i++) {
+            filter.buckets_[i] = detail::load_le64(data + detail::FILTER_HEADER_SIZE + i * 8);
+            for (std::size_t lane = 0; lane < BUCKET_SIZE; lane++) occupied += ((filter.buckets_[i] >> (lane * 16)) & 0xFFFF) != 0;
+        }
+        if (occupied != filter.size_) throw invalid_format_error("Invalid uuidv7 cuckoo filter size");
+        return filter;
+    }
+
+    /// @brief Insert a UUID
+    /// @param uuid UUID to insert
+    /// @return `true` if inserted; `false` if the filter is full
+    bool insert(const uuidv7& uuid) noexcept {
+        if (victim_ != 0) return false;
+        std::uint16_t fp;
+        const std::size_t index = primary(uuid, fp);
+        add(index, fp);
+        return true;
+    }
+
+    /// @brief Check whether a UUID may have been inserted
+    /// @param uuid UUID to check
+    /// @return `false` if the UUID is not in the filter; `true` if it probably is
+    bool contains(const uuidv7& uuid) const noexcept {
+        std::uint16_t fp;
+        const std::size_t i1 = primary(uuid, fp);
+        const std::size_t i2 = alternate(i1, fp);
+        const std::uint64_t pattern = fp * detail::CUCKOO_LANES;
+        if (detail::cuckoo_zero_lanes(buckets_[i1] ^ pattern) | detail::cuckoo_zero_lanes(buckets_[i2] ^ pattern))
+            return true;
+        return victim_ == fp && (victim_index_ == i1 || victim_index_ == i2);
+    }
+
+    /// @brief Erase a UUID that was inserted
+    /// @param uuid UUID to erase
+    /// @return `true` if a matching fingerprint was removed
+    bool erase(const uuidv7& uuid) noexcept {
+        std::uint16_t fp;
+        const std::size_t i1 = primary(uuid, fp);
+        const std::size_t i2 = alternate(i1, fp);
+        if (victim_ == fp && (victim_index_ == i1 || victim_index_ == i2)) {
+            victim_ = 0;
+            size_--;
+            return true;
+        }
+        if (!remove(i1, fp) && !remove(i2, fp)) return false;
+        size_--;
+        // Retry placing the victim now that a slot is free
+        if (victim_ != 0) {
+            const std::uint16_t victim = victim_;
+            victim_ = 0;
+            size_--;
+            add(victim_index_, victim);
+        }
+        return true;
+    }
+
+    /// @brief Remove all UUIDs
+    void clear() noexcept {
+        std::fill(buckets_.begin(), buckets_.end(), std::uint64_t(0));
+        size_ = 0;
+        victim_ = 0;
+    }
+
+    /// @brief Get the number of stored UUIDs
+    /// @return Number of fingerprints in the filter
+    std::size_t size() const noexcept { return size_; }
+
+    /// @brief Get the number of fingerprint slots
+    /// @return Number of buckets times `BUCKET_SIZE`
+    std::size_t capacity() const noexcept { return buckets_.size() * BUCKET_SIZE; }
+
+    /// @brief Serialize the filter
+    /// @return Serialized bytes
+    std::vector<std::uint8_t> to_bytes() const {
+        std::vector<std::uint8_t> out(detail::FILTER_HEADER_SIZE + buckets_.size() * 8);
+        detail::store_le32(out.data(), detail::CUCKOO_MAGIC);
+        detail::store_le32(out.data() + 4, detail::FILTER_LAYOUT);
+        detail::store_le64(out.data() + 8, buckets_.size());
+        detail::store_le64(out.data() + 16, size_);
+        detail::store_le64(out.data() + 24, victim_index_);
+        out[32] = static_cast<std::uint8_t>(victim_);
+        out[33] = static_cast<std::uint8_t>(victim_ >> 8);
+        for (std::size_t i = 0; i < buckets_.size(); i++)
+            detail::store_le64(out.data() + detail::FILTER_HEADER_SIZE + i * 8, buckets_[i]);
+        return out;
+    }
+
+private:
+    static constexpr int MAX_KICKS = 500;
+
+    std::vector<std::uint64_t> buckets_;
+    std::size_t size_ = 0;
+    std::uint16_t victim_ = 0;
+    std::size_t victim_index_ = 0;
+    std::uint64_t random_ = 0x9E3779B97F4A7C15;
+
+    uuidv7_cuckoo_filter() = default;
+
+    /// Primary bucket and nonzero fingerprint (zero marks an empty slot)
+    std::size_t primary(const uuidv7& uuid, std::uint16_t& fp) const noexcept {
+        const std::uint64_t hash = detail::mix_hash_bytes(uuidv7_view(uuid).data());
+        fp = static_cast<std::uint16_t>(hash >> 48);
+        if (fp == 0) fp = 1;
+        return static_cast<std::size_t>(hash) & (buckets_.size() - 1);
+    }
+
+    /// The other bucket of a fingerprint (an involution, so it also maps back).
+    /// The offset is the top bits of a multiplicative hash of the fingerprint, which depend on
+    /// every fingerprint bit, and is never 0 so the two buckets always differ.
+    std::size_t alternate(std::size_t index, std::uint16_t fp) const noexcept {
+        const unsigned bits = detail::count_trailing_zeros(buckets_.size());
+        std::size_t offset = static_cast<std::size_t>((fp * 0x9E3779B97F4A7C15ULL) >> (64 - bits));
+        if (offset == 0) offset = 1;
+        return index ^ offset;
+    }
+
+    bool place(std::size_t index, std::uint16_t fp) noexcept {
+        const std::uint64_t empty = detail::cuckoo_zero_lanes(buckets_[index]);
+        if (empty == 0) return false;
+        // The lowest flagged lane is exactly zero
+        buckets_[index] |= static_cast<std::uint64_t>(fp) << (detail::count_trailing_zeros(empty) - 15);
+        return true;
+    }
+
+    bool remove(std::size_t index, std::uint16_t fp) noexcept {
+        const std::uint64_t match = detail::cuckoo_zero_lanes(buckets_[index] ^ (fp * detail::CUCKOO_LANES));
+        if (match == 0) return false;
+        buckets_[index] &= ~(std::uint64_t(0xFFFF) << (detail::count_trailing_zeros(match) - 15));
+        return true;
+    }
+
+    /// Store a fingerprint, relocating others to their alternate buckets until one finds a free slot.
+    /// The last homeless fingerprint is kept aside as the victim, which makes the filter full.
+    void add(std::size_t index, std::uint16_t fp) noexcept {
+        size_++;
+        if (place(index, fp) || place(alternate(index, fp), fp)) return;
+        if (next_random() & 1) index = alternate(index, fp);
+        for (int kick = 0; kick < MAX_KICKS; kick++) {
+            const int shift = static_cast<int>(next_random() % BUCKET_SIZE) * 16;
+            const std::uint16_t evicted = static_cast<std::uint16_t>(buckets_[index] >> shift);
+            buckets_[index] ^= static_cast<std::uint64_t>(evicted ^ fp) << shift;
+            fp = evicted;
+            index = alternate(index, fp);
+            if (place(index, fp)) return;
+        }
+        victim_ = fp;
+        victim_index_ = index;
+    }
+
+    std::uint64_t next_random() noexcept {
+        random_ ^= random_ << 13;
+        random_ ^= random_ >> 7;
+        random_ ^= random_ << 17;
+        return random_;
+    }
+};
+
+} // namespace uuidv7
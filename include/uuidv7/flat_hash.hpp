@@ -0,0 +1,614 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "uuidv7.hpp"
+#include "view.hpp"
+#include "detail/bits.hpp"
+
+namespace uuidv7 {
+
+/// @brief Hash function for `uuidv7` keys in `uuidv7_flat_set` and `uuidv7_flat_map`
+///
+/// `rand_b` is random in generator output, but counter policies increment it within a
+/// millisecond and seeds may carry little entropy, so the upper 64 bits are folded in and
+/// a single multiplication spreads consecutive values over the whole word.
+struct uuidv7_flat_hash {
+    /// @cond Doxygen_suppress
+    std::size_t operator()(const uuidv7& uuid) const noexcept {
+        return static_cast<std::size_t>(detail::mix_hash_bytes(uuidv7_view(uuid).data()));
+    }
+    /// @endcond
+};
+
+/// @cond Doxygen_suppress
+namespace detail {
+    /// Control bytes: a full slot holds 7 bits of its hash (non-negative); free slots are negative
+    constexpr std::int8_t CTRL_EMPTY = -128;
+    constexpr std::int8_t CTRL_DELETED = -2;
+    constexpr std::size_t GROUP_SIZE = 16;
+
+    /// Key equality as two 8-byte comparisons (`std::array` equality may call `memcmp`)
+    inline bool same_key(const uuidv7& lhs, const uuidv7& rhs) noexcept {
+        std::uint64_t a[2], b[2];
+        std::memcpy(a, uuidv7_view(lhs).data(), 16);
+        std::memcpy(b, uuidv7_view(rhs).data(), 16);
+        return ((a[0] ^ b[0]) | (a[1] ^ b[1])) == 0;
+    }
+
+    /// Bitmasks over the 16 control bytes of a group
+    struct flat_group {
+        const std::int8_t* ctrl;
+
+#if defined(UUIDV7LIB_SSE2)
+        std::uint32_t match(std::int8_t h2) const noexcept {
+            return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(load(), _mm_set1_epi8(h2))));
+        }
+        std::uint32_t match_empty() const noexcept { return match(CTRL_EMPTY); }
+        std::uint32_t match_free() const noexcept { return static_cast<std::uint32_t>(_mm_movemask_epi8(load())); }
+        __m128i load() const noexcept { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl)); }
+#else
+        std::uint32_t match(std::int8_t h2) const noexcept {
+            std::uint32_t mask = 0;
+            for (std::size_t i = 0; i < GROUP_SIZE; i++) mask |= static_cast<std::uint32_t>(ctrl[i] == h2) << i;
+            return mask;
+        }
+        std::uint32_t match_empty() const noexcept { return match(CTRL_EMPTY); }
+        std::uint32_t match_free() const noexcept {
+            std::uint32_t mask = 0;
+            for (std::size_t i = 0; i < GROUP_SIZE; i++) mask |= static_cast<std::uint32_t>(ctrl[i] < 0) << i;
+            return mask;
+        }
+#endif
+    };
+
+    /// Open-addressing table of `Value` keyed by `uuidv7` (SwissTable layout).
+    /// Slots are split into groups of 16 with one control byte each; a lookup compares the
+    /// 7-bit hash fragment against a whole group at once and only then compares keys.
+    /// Groups are probed triangularly, which visits every group of a power-of-two table.
+    template <class Value, class Hash>
+    class flat_table {
+    public:
+        static constexpr std::size_t NPOS = static_cast<std::size_t>(-1);
+
+        flat_table() = default;
+        explicit flat_table(const Hash& hash) : hash_(hash) {}
+
+        flat_table(const flat_table& other) : hash_(other.hash_) {
+            if (!other.ctrl_) return;
+            // Built aside and marked full slot by slot, so a throwing copy destroys only what was constructed
+            flat_table copy(hash_);
+            copy.allocate(other.group_mask_ + 1);
+            for (std::size_t i = 0; i < copy.capacity(); i++) {
+                if (other.ctrl_[i] >= 0) ::new (static_cast<void*>(&copy.slots_[i].value)) Value(other.slots_[i].value);
+                copy.ctrl_[i] = other.ctrl_[i];
+            }
+            copy.size_ = other.size_;
+            copy.growth_left_ = other.growth_left_;
+            swap(copy);
+        }
+        flat_table(flat_table&& other) noexcept
+            : ctrl_(other.ctrl_), slots_(other.slots_), group_mask_(other.group_mask_),
+              size_(other.size_), growth_left_(other.growth_left_), hash_(std::move(other.hash_))
+        {
+            other.ctrl_ = nullptr;
+            other.slots_ = nullptr;
+            other.group_mask_ = 0;
+            other.size_ = 0;
+            other.growth_left_ = 0;
+        }
+        flat_table& operator=(flat_table other) noexcept {
+            swap(other);
+            return *this;
+        }
+        ~flat_table() { release(); }
+
+        void swap(flat_table& other) noexcept {
+            std::swap(ctrl_, other.ctrl_);
+            std::swap(slots_, other.slots_);
+            std::swap(group_mask_, other.group_mask_);
+            std::swap(size_, other.size_);
+            std::swap(growth_left_, other.growth_left_);
+            std::swap(hash_, other.hash_);
+        }
+
+        std::size_t size() const noexcept { return size_; }
+        std::size_t capacity() const noexcept { return ctrl_ ? (group_mask_ + 1) * GROUP_SIZE : 0; }
+        const Hash& hash_function() const noexcept { return hash_; }
+
+        bool full_at(std::size_t i) const noexcept { return ctrl_[i] >= 0; }
+        Value& value_at(std::size_t i) noexcept { return slots_[i].value; }
+        const Value& value_at(std::size_t i) const noexcept { return slots_[i].value; }
+
+        static const uuidv7& key_of(const uuidv7& value) noexcept { return value; }
+        template <class T>
+        static const uuidv7& key_of(const std::pair<const uuidv7, T>& value) noexcept { return value.first; }
+
+        std::size_t find(const uuidv7& key) const noexcept { return find(key, hash_(key)); }
+
+        std::size_t find(const uuidv7& key, std::size_t hash) const noexcept {
+            if (!ctrl_) return NPOS;
+            const std::int8_t h2 = h2_of(hash);
+            std::size_t group = hash & group_mask_;
+            for (std::size_t step = 1;; step++) {
+                flat_group g { ctrl_ + group * GROUP_SIZE };
+                for (std::uint32_t match = g.match(h2); match; match &= match - 1) {
+                    std::size_t i = group * GROUP_SIZE + count_trailing_zeros(match);
+                    if (same_key(key_of(slots_[i].value), key)) return i;
+                }
+                if (g.match_empty()) return NPOS;
+                group = (group + step) & group_mask_;
+            }
+        }
+
+        /// Insert `Value(args...)` unless `key` is present; returns the slot and whether it was inserted
+        template <class... Args>
+        std::pair<std::size_t, bool> emplace(const uuidv7& key, Args&&... args) {
+            const std::size_t hash = hash_(key);
+            const std::int8_t h2 = h2_of(hash);
+            // One probe finds the key or, failing that, the first free slot on its probe sequence
+            std::size_t i = NPOS;
+            if (ctrl_) {
+                std::size_t group = hash & group_mask_;
+                for (std::size_t step = 1;; step++) {
+                    flat_group g { ctrl_ + group * GROUP_SIZE };
+                    for (std::uint32_t match = g.match(h2); match; match &= match - 1) {
+                        std::size_t j = group * GROUP_SIZE + count_trailing_zeros(match);
+                        if (same_key(key_of(slots_[j].value), key)) return { j, false };
+                    }
+                    std::uint32_t free = g.match_free();
+                    if (i == NPOS && free) i = group * GROUP_SIZE + count_trailing_zeros(free);
+                    if (g.match_empty()) break;
+                    group = (group + step) & group_mask_;
+                }
+            }
+            // Growing moves the slots; reusing a tombstone needs no growth
+            if (i == NPOS || (growth_left_ == 0 && ctrl_[i] == CTRL_EMPTY)) {
+                grow();
+                i = find_free(hash);
+            }
+            ::new (static_cast<void*>(&slots_[i].value)) Value(std::forward<Args>(args)...);
+            // Reusing a tombstone does not consume growth
+            if (ctrl_[i] == CTRL_EMPTY) growth_left_--;
+            ctrl_[i] = h2;
+            size_++;
+            return { i, true };
+        }
+
+        void erase_at(std::size_t i) noexcept {
+            slots_[i].value.~Value();
+            size_--;
+            // A group that still has an empty slot never made a probe continue past it,
+            // so the slot can become empty again instead of a tombstone
+            if (flat_group { ctrl_ + (i & ~(GROUP_SIZE - 1)) }.match_empty()) {
+                ctrl_[i] = CTRL_EMPTY;
+                growth_left_++;
+            } else {
+                ctrl_[i] = CTRL_DELETED;
+            }
+        }
+
+        void clear() noexcept {
+            destroy_all();
+            std::fill(ctrl_, ctrl_ + capacity(), CTRL_EMPTY);
+            size_ = 0;
+            growth_left_ = max_load(capacity());
+        }
+
+        void reserve(std::size_t count) {
+            if (count > size_ + growth_left_) rehash(groups_for(count));
+        }
+
+    private:
+        union alignas(16) slot {
+            Value value;
+            slot() noexcept {}
+            ~slot() {}
+        };
+
+        std::int8_t* ctrl_ = nullptr;
+        slot* slots_ = nullptr;
+        std::size_t group_mask_ = 0;
+        std::size_t size_ = 0;
+        std::size_t growth_left_ = 0;
+        Hash hash_;
+
+        /// The 7 high bits of the hash; the low bits select the group
+        static std::int8_t h2_of(std::size_t hash) noexcept {
+            return static_cast<std::int8_t>(hash >> (sizeof(std::size_t) * 8 - 7));
+        }
+        /// Maximum number of full and deleted slots (7/8 load factor)
+        static std::size_t max_load(std::size_t capacity) noexcept { return capacity - capacity / 8; }
+        static std::size_t groups_for(std::size_t count) noexcept {
+            std::size_t groups = 1;
+            while (max_load(groups * GROUP_SIZE) < count) groups *= 2;
+            return groups;
+        }
+
+        std::size_t find_free(std::size_t hash) const noexcept {
+            std::size_t group = hash & group_mask_;
+            for (std::size_t step = 1;; step++) {
+                std::uint32_t free = flat_group { ctrl_ + group * GROUP_SIZE }.match_free();
+                if (free) return group * GROUP_SIZE + count_trailing_zeros(free);
+                group = (group + step) & group_mask_;
+            }
+        }
+
+        void grow() {
+            // Mostly tombstones: rebuild at the same capacity instead of doubling
+            if (ctrl_ && size_ < max_load(capacity()) / 2) rehash(group_mask_ + 1);
+            else rehash(ctrl_ ? (group_mask_ + 1) * 2 : 1);
+        }
+
+        void allocate(std::size_t groups) {
+            const std::size_t capacity = groups * GROUP_SIZE;
+            slots_ = new slot[capacity];
+            try {
+                ctrl_ = new std::int8_t[capacity];
+            } catch (...) {
+                delete[] slots_;
+                slots_ = nullptr;
+                throw;
+            }
+            std::fill(ctrl_, ctrl_ + capacity, CTRL_EMPTY);
+            group_mask_ = groups - 1;
+            size_ = 0;
+            growth_left_ = max_load(capacity);
+        }
+
+        void rehash(std::size_t groups) {
+            flat_table fresh(hash_);
+            fresh.allocate(groups);
+            for (std::size_t i = 0; i < capacity(); i++) {
+                if (ctrl_[i] < 0) continue;
+                const std::size_t hash = hash_(key_of(slots_[i].value));
+                std::size_t j = fresh.find_free(hash);
+                ::new (static_cast<void*>(&fresh.slots_[j].value)) Value(std::move(slots_[i].value));
+                fresh.ctrl_[j] = h2_of(hash);
+                fresh.size_++;
+                fresh.growth_left_--;
+            }
+            swap(fresh);
+        }
+
+        void destroy_all() noexcept {
+            if constexpr (std::is_trivially_destructible<Value>::value) return;
+            for (std::size_t i = 0; i < capacity(); i++) {
+                if (ctrl_[i] >= 0) slots_[i].value.~Value();
+            }
+        }
+
+        void release() noexcept {
+            if (!ctrl_) return;
+            destroy_all();
+            delete[] slots_;
+            delete[] ctrl_;
+            ctrl_ = nullptr;
+            slots_ = nullptr;
+        }
+    };
+
+    /// Forward iterator over the full slots of a `flat_table`
+    template <class Table, class Value>
+    class flat_iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::remove_const_t<Value>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = Value*;
+        using reference = Value&;
+
+        flat_iterator() = default;
+        flat_iterator(Table* table, std::size_t index) noexcept : table_(table), index_(index) { skip_free(); }
+
+        /// Conversion from a mutable iterator to a const iterator
+        template <class OtherTable, class OtherValue,
+                  class = std::enable_if_t<std::is_convertible<OtherValue*, Value*>::value>>
+        flat_iterator(const flat_iterator<OtherTable, OtherValue>& other) noexcept
+            : table_(other.table()), index_(other.index()) {}
+
+        reference operator*() const noexcept { return table_->value_at(index_); }
+        pointer operator->() const noexcept { return &table_->value_at(index_); }
+        flat_iterator& operator++() noexcept {
+            index_++;
+            skip_free();
+            return *this;
+        }
+        flat_iterator operator++(int) noexcept {
+            flat_iterator result = *this;
+            ++*this;
+            return result;
+        }
+        friend bool operator==(const flat_iterator& lhs, const flat_iterator& rhs) noexcept { return lhs.index_ == rhs.index_; }
+        friend bool operator!=(const flat_iterator& lhs, const flat_iterator& rhs) noexcept { return lhs.index_ != rhs.index_; }
+
+        Table* table() const noexcept { return table_; }
+        std::size_t index() const noexcept { return index_; }
+
+    private:
+        Table* table_ = nullptr;
+        std::size_t index_ = 0;
+
+        void skip_free() noexcept {
+            while (index_ < table_->capacity() && !table_->full_at(index_)) index_++;
+        }
+    };
+} // namespace detail
+/// @endcond
+
+/// @brief Hash set of `uuidv7` with open addressing
+///
+/// Keys are stored inline in one 16-byte-aligned array, next to a control byte per slot
+/// holding 7 bits of the key's hash (SwissTable layout). A lookup checks 16 control bytes
+/// at once with SSE2 and compares keys only on a fragment match, so it typically touches
+/// two cache lines and never chases node pointers as `std::unordered_set` does.
+///
+/// Iterators and references are invalidated by insertions that grow the table.
+/// @tparam Hash Hash function (must spread entropy over all bits, see `uuidv7_flat_hash`)
+template <class Hash = uuidv7_flat_hash>
+class uuidv7_flat_set {
+    using table_type = detail::flat_table<uuidv7, Hash>;
+
+public:
+    /// @brief Key type
+    using key_type = uuidv7;
+    /// @brief Value type
+    using value_type = uuidv7;
+    /// @brief Size type
+    using size_type = std::size_t;
+    /// @brief Hash function type
+    using hasher = Hash;
+    /// @brief Iterator type (elements cannot be modified in place)
+    using iterator = detail::flat_iterator<const table_type, const uuidv7>;
+    /// @brief Const iterator type
+    using const_iterator = iterator;
+
+    /// @brief Create an empty set (no allocation until the first insertion)
+    uuidv7_flat_set() = default;
+
+    /// @brief Create an empty set with room for `count` UUIDs
+    /// @param count Number of UUIDs to hold without growing
+    /// @param hash Hash function object
+    explicit uuidv7_flat_set(std::size_t count, const Hash& hash = Hash()) : table_(hash) { table_.reserve(count); }
+
+    /// @brief Create a set from a range of UUIDs
+    /// @param first Beginning of the range
+    /// @param last End of the range
+    template <class InputIt>
+    uuidv7_flat_set(InputIt first, InputIt last) {
+        for (; first != last; ++first) insert(*first);
+    }
+
+    /// @brief Get the number of UUIDs
+    /// @return Number of UUIDs in the set
+    std::size_t size() const noexcept { return table_.size(); }
+    /// @brief Check whether the set is empty
+    /// @return `true` if the set holds no UUID
+    bool empty() const noexcept { return table_.size() == 0; }
+    /// @brief Get the number of slots
+    /// @return Number of slots (at most 7/8 of them are used before the table grows)
+    std::size_t capacity() const noexcept { return table_.capacity(); }
+    /// @brief Get the hash function
+    /// @return Hash function object
+    hasher hash_function() const { return table_.hash_function(); }
+
+    /// @brief Make room for `count` UUIDs without further growth
+    /// @param count Number of UUIDs
+    void reserve(std::size_t count) { table_.reserve(count); }
+    /// @brief Remove all UUIDs (the capacity is kept)
+    void clear() noexcept { table_.clear(); }
+
+    /// @brief Insert a UUID
+    /// @param uuid UUID to insert
+    /// @return Iterator to the UUID, and `true` if it was inserted (`false` if it was already present)
+    std::pair<iterator, bool> insert(const uuidv7& uuid) {
+        auto result = table_.emplace(uuid, uuid);
+        return { iterator(&table_, result.first), result.second };
+    }
+
+    /// @brief Find a UUID
+    /// @param uuid UUID to search
+    /// @return Iterator to the UUID, or `end()`
+    iterator find(const uuidv7& uuid) const noexcept {
+        std::size_t i = table_.find(uuid);
+        return i == table_type::NPOS ? end() : iterator(&table_, i);
+    }
+    /// @brief Check whether a UUID is in the set
+    /// @param uuid UUID to search
+    /// @return `true` if the UUID is in the set
+    bool contains(const uuidv7& uuid) const noexcept { return table_.find(uuid) != table_type::NPOS; }
+    /// @brief Count the occurrences of a UUID
+    /// @param uuid UUID to search
+    /// @return 1 if the UUID is in the set, 0 otherwise
+    std::size_t count(const uuidv7& uuid) const noexcept { return contains(uuid) ? 1 : 0; }
+
+    /// @brief Remove a UUID
+    /// @param uuid UUID to remove
+    /// @return Number of UUIDs removed (0 or 1)
+    std::size_t erase(const uuidv7& uuid) noexcept {
+        std::size_t i = table_.find(uuid);
+        if (i == table_type::NPOS) return 0;
+        table_.erase_at(i);
+        return 1;
+    }
+
+    /// @brief Get an iterator to the first UUID (in no particular order)
+    /// @return Iterator to the first UUID
+    iterator begin() const noexcept { return iterator(&table_, 0); }
+    /// @brief Get an iterator past the last UUID
+    /// @return End iterator
+    iterator end() const noexcept { return iterator(&table_, table_.capacity()); }
+
+private:
+    table_type table_;
+};
+
+/// @brief Hash map from `uuidv7` to `T` with open addressing
+///
+/// Same layout as `uuidv7_flat_set`, storing `std::pair<const uuidv7, T>` inline in the slots.
+/// Iterators and references are invalidated by insertions that grow the table.
+/// @tparam T Mapped type
+/// @tparam Hash Hash function (must spread entropy over all bits, see `uuidv7_flat_hash`)
+template <class T, class Hash = uuidv7_flat_hash>
+class uuidv7_flat_map {
+public:
+    /// @brief Key type
+    using key_type = uuidv7;
+    /// @brief Mapped type
+    using mapped_type = T;
+    /// @brief Value type
+    using value_type = std::pair<const uuidv7, T>;
+    /// @brief Size type
+    using size_type = std::size_t;
+    /// @brief Hash function type
+    using hasher = Hash;
+
+private:
+    using table_type = detail::flat_table<value_type, Hash>;
+
+public:
+    /// @brief Iterator type
+    using iterator = detail::flat_iterator<table_type, value_type>;
+    /// @brief Const iterator type
+    using const_iterator = detail::flat_iterator<const table_type, const value_type>;
+
+    /// @brief Create an empty map (no allocation until the first insertion)
+    uuidv7_flat_map() = default;
+
+    /// @brief Create an empty map with room for `count` entries
+    /// @param count Number of entries to hold without growing
+    /// @param hash Hash function object
+    explicit uuidv7_flat_map(std::size_t count, const Hash& hash = Hash()) : table_(hash) { table_.reserve(count); }
+
+    /// @brief Get the number of entries
+    /// @return Number of entries in the map
+    std::size_t size() const noexcept { return table_.size(); }
+    /// @brief Check whether the map is empty
+    /// @return `true` if the map holds no entry
+    bool empty() const noexcept { return table_.size() == 0; }
+    /// @brief Get the number of slots
+    /// @return Number of slots (at most 7/8 of them are used before the table grows)
+    std::size_t capacity() const noexcept { return table_.capacity(); }
+    /// @brief Get the hash function
+    /// @return Hash function object
+    hasher hash_function() const { return table_.hash_function(); }
+
+    /// @brief Make room for `count` entries without further growth
+    /// @param count Number of entries
+    void reserve(std::size_t count) { table_.reserve(count); }
+    /// @brief Remove all entries (the capacity is kept)
+    void clear() noexcept { table_.clear(); }
+
+    /// @brief Insert an entry constructed in place unless the key is present
+    /// @param key Key
+    /// @param args Arguments to construct the mapped value
+    /// @return Iterator to the entry, and `true` if it was inserted
+    template <class... Args>
+    std::pair<iterator, bool> try_emplace(const uuidv7& key, Args&&... args) {
+        auto result = table_.emplace(key, std::piecewise_construct, std::forward_as_tuple(key),
+                                     std::forward_as_tuple(std::forward<Args>(args)...));
+        return { iterator(&table_, result.first), result.second };
+    }
+
+    /// @brief Insert an entry unless its key is present
+    /// @param value Entry to insert
+    /// @return Iterator to the entry, and `true` if it was inserted
+    std::pair<iterator, bool> insert(const value_type& value) {
+        auto result = table_.emplace(value.first, value);
+        return { iterator(&table_, result.first), result.second };
+    }
+
+    /// @brief Insert an entry, or assign the mapped value if the key is present
+    /// @param key Key
+    /// @param obj Mapped value
+    /// @return Iterator to the entry, and `true` if it was inserted
+    template <class M>
+    std::pair<iterator, bool> insert_or_assign(const uuidv7& key, M&& obj) {
+        auto result = try_emplace(key, std::forward<M>(obj));
+        if (!result.second) result.first->second = std::forward<M>(obj);
+        return result;
+    }
+
+    /// @brief Access the mapped value, inserting a value-initialized one if the key is absent
+    /// @param key Key
+    /// @return Reference to the mapped value
+    T& operator[](const uuidv7& key) { return try_emplace(key).first->second; }
+
+    /// @brief Access the mapped value
+    /// @param key Key
+    /// @return Reference to the mapped value
+    /// @throw std::out_of_range if the key is absent
+    T& at(const uuidv7& key) {
+        std::size_t i = table_.find(key);
+        if (i == table_type::NPOS) throw std::out_of_range("uuidv7 key is not in the map");
+        return table_.value_at(i).second;
+    }
+    /// @brief Access the mapped value
+    /// @param key Key
+    /// @return Reference to the mapped value
+    /// @throw std::out_of_range if the key is absent
+    const T& at(const uuidv7& key) const {
+        std::size_t i = table_.find(key);
+        if (i == table_type::NPOS) throw std::out_of_range("uuidv7 key is not in the map");
+        return table_.value_at(i).second;
+    }
+
+    /// @brief Find an entry
+    /// @param key Key
+    /// @return Iterator to the entry, or `end()`
+    iterator find(const uuidv7& key) noexcept {
+        std::size_t i = table_.find(key);
+        return i == table_type::NPOS ? end() : iterator(&table_, i);
+    }
+    /// @brief Find an entry
+    /// @param key Key
+    /// @return Iterator to the entry, or `end()`
+    const_iterator find(const uuidv7& key) const noexcept {
+        std::size_t i = table_.find(key);
+        return i == table_type::NPOS ? end() : const_iterator(&table_, i);
+    }
+    /// @brief Check whether a key is in the map
+    /// @param key Key
+    /// @return `true` if the key is in the map
+    bool contains(const uuidv7& key) const noexcept { return table_.find(key) != table_type::NPOS; }
+    /// @brief Count the entries with a key
+    /// @param key Key
+    /// @return 1 if the key is in the map, 0 otherwise
+    std::size_t count(const uuidv7& key) const noexcept { return contains(key) ? 1 : 0; }
+
+    /// @brief Remove an entry
+    /// @param key Key
+    /// @return Number of entries removed (0 or 1)
+    std::size_t erase(const uuidv7& key) {
+        std::size_t i = table_.find(key);
+        if (i == table_type::NPOS) return 0;
+        table_.erase_at(i);
+        return 1;
+    }
+
+    /// @brief Get an iterator to the first entry (in no particular order)
+    /// @return Iterator to the first entry
+    iterator begin() noexcept { return iterator(&table_, 0); }
+    /// @brief Get an iterator past the last entry
+    /// @return End iterator
+    iterator end() noexcept { return iterator(&table_, table_.capacity()); }
+    /// @brief Get an iterator to the first entry (in no particular order)
+    /// @return Iterator to the first entry
+    const_iterator begin() const noexcept { return const_iterator(&table_, 0); }
+    /// @brief Get an iterator past the last entry
+    /// @return End iterator
+    const_iterator end() const noexcept { return const_iterator(&table_, table_.capacity()); }
+
+private:
+    table_type table_;
+};
+
+} // namespace uuidv7
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <fmt/format.h>
+#include "uuidv7.hpp"
+#include "view.hpp"
+
+namespace fmt {
+    /// @brief `fmt::format` support for `uuidv7` (opt-in header, requires {fmt})
+    ///
+    /// Writes directly to the output iterator without allocating. Format spec:
+    /// `{}` or `{:x}` (hyphenated lower-case hex), `{:X}` (upper-case hex), `{:n}` (no hyphens),
+    /// `{:b}` (in braces) and `{:c}` (Crockford Base32). `X`, `n` and `b` can be combined, e.g. `{:bX}`.
+    template <>
+    struct formatter<uuidv7::uuidv7> {
+        /// @cond Doxygen_suppress
+        template <class ParseContext>
+        constexpr auto parse(ParseContext& ctx) {
+            auto it = ctx.begin();
+            if (!uuidv7::detail::parse_format_spec(it, ctx.end(), spec_))
+                throw fmt::format_error("Invalid format spec for uuidv7");
+            return it;
+        }
+
+        template <class FormatContext>
+        auto format(const uuidv7::uuidv7& uuid, FormatContext& ctx) const {
+            return format_bytes(uuid.get_bytes().data(), ctx);
+        }
+
+    protected:
+        uuidv7::detail::format_spec spec_;
+
+        template <class FormatContext>
+        auto format_bytes(const std::uint8_t* bytes, FormatContext& ctx) const {
+            char buffer[uuidv7::detail::MAX_FORMATTED_LENGTH];
+            char* end = uuidv7::detail::write_formatted(bytes, spec_, buffer);
+            return std::copy(buffer, end, ctx.out());
+        }
+        /// @endcond
+    };
+
+    /// @brief `fmt::format` support for `uuidv7_view` (same format spec as `uuidv7`)
+    template <>
+    struct formatter<uuidv7::uuidv7_view> : formatter<uuidv7::uuidv7> {
+        /// @cond Doxygen_suppress
+        template <class FormatContext>
+        auto format(uuidv7::uuidv7_view uuid, FormatContext& ctx) const {
+            return format_bytes(uuid.data(), ctx);
+        }
+        /// @endcond
+    };
+} // namespace fmt
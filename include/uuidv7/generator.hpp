@@ -1,10 +1,28 @@
 #pragma once
 
 #include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
 #include <cstdint>
+#include <exception>
 #include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
 #include "uuidv7.hpp"
 
+#if defined(__linux__)
+    #include <time.h>
+#endif
+
+#if __cpp_impl_coroutine >= 201902L && __has_include(<coroutine>)
+    #include <coroutine>
+    #define UUIDV7LIB_COROUTINES
+#endif
+
 namespace uuidv7 {
 
 /// @brief Error class representing a sequence overflow error within the same millisecond for `uuidv7`
@@ -15,42 +33,444 @@ public:
     sequence_overflow_error(const std::string& message) : std::runtime_error(message) {}
 };
 
-/// @brief `uuidv7` generator class
+
+// --- Clock Policies ---
+/// @brief Clock policy reading the coarse (tick-granular) real-time clock
+///
+/// On Linux this reads `CLOCK_REALTIME_COARSE`, which is served from the vDSO
+/// without touching the hardware counter. Its resolution is one scheduler tick
+/// (typically 1-4 ms), so more UUIDs share a timestamp and are ordered by the counter.
+/// On other platforms it falls back to `std::chrono::system_clock`.
+struct coarse_system_clock {
+    /// @cond Doxygen_suppress
+    using duration = std::chrono::system_clock::duration;
+    using rep = duration::rep;
+    using period = duration::period;
+    using time_point = std::chrono::system_clock::time_point;
+    static constexpr bool is_steady = false;
+    /// @endcond
+
+    /// @brief Get the current time
+    /// @return Current time point (Unix epoch)
+    static time_point now() noexcept {
+#if defined(__linux__) && defined(CLOCK_REALTIME_COARSE)
+        timespec ts;
+        if (clock_gettime(CLOCK_REALTIME_COARSE, &ts) == 0) {
+            return time_point(std::chrono::duration_cast<duration>(
+                std::chrono::seconds(ts.tv_sec) + std::chrono::nanoseconds(ts.tv_nsec)));
+        }
+#endif
+        return std::chrono::system_clock::now();
+    }
+};
+
+
+// --- Entropy Policies ---
+/// @brief Entropy policy using the platform CSPRNG selected at build time
+///
+/// The backend is selected at build time in this order (see `src/csprng/`): OpenSSL `RAND_bytes`
+/// when OpenSSL is found (unless `UUIDV7LIB_FORCE_NATIVE`), then Windows `BCryptGenRandom`,
+/// `arc4random_buf` and `getrandom`.
+///
+/// | Backend | Can block |
+/// |---------|-----------|
+/// | OpenSSL `RAND_bytes` | While seeding from the OS on first use, i.e. on Linux until the kernel entropy pool is initialized |
+/// | `BCryptGenRandom` (Windows) | Never |
+/// | `arc4random_buf` (BSD, macOS) | Never |
+/// | `arc4random_buf` (Linux, glibc 2.36+) | Until the kernel entropy pool is initialized (early boot only) |
+/// | `getrandom` (Linux) | Until the kernel entropy pool is initialized (early boot only) |
+struct UUIDV7LIB_EXPORT csprng_entropy {
+    /// @brief Generate 10 random bytes with CSPRNG
+    /// @return 10-byte array of random bytes
+    /// @throw std::system_error if random number generation fails (OS-specific CSPRNG call fails)
+    /// @throw std::runtime_error if random number generation fails (CSPRNG library call fails)
+    std::array<std::uint8_t, 10> operator()();
+
+    /// @brief Check whether generating random bytes would not block
+    /// @return `false` if the CSPRNG is still waiting for entropy; once `true`, it stays `true`
+    static bool ready() noexcept;
+};
+
+/// @brief Entropy policy that never calls a CSPRNG and always yields zero bytes
+///
+/// Intended for counter-only configurations where uniqueness comes from the
+/// counter policy (e.g. an embedded node identifier) instead of randomness.
+struct no_entropy {
+    /// @brief Generate 10 zero bytes
+    /// @return 10-byte array filled with zero
+    constexpr std::array<std::uint8_t, 10> operator()() const noexcept { return {}; }
+};
+
+
+// --- Lock Policies ---
+/// @brief Lock policy that performs no synchronization
+///
+/// Use only when a generator instance is confined to a single thread.
+struct null_lock {
+    /// @cond Doxygen_suppress
+    constexpr void lock() noexcept {}
+    constexpr bool try_lock() noexcept { return true; }
+    constexpr void unlock() noexcept {}
+    /// @endcond
+};
+
+/// @brief Lock policy using a test-and-test-and-set spin lock
+///
+/// The critical section of `generate()` is a few dozen instructions,
+/// so spinning is usually cheaper than parking the thread in `std::mutex`.
+class spin_lock {
+public:
+    /// @cond Doxygen_suppress
+    spin_lock() = default;
+    spin_lock(const spin_lock&) = delete;
+    spin_lock& operator=(const spin_lock&) = delete;
+
+    void lock() noexcept {
+        while (locked_.exchange(true, std::memory_order_acquire)) {
+            while (locked_.load(std::memory_order_relaxed)) {}
+        }
+    }
+    bool try_lock() noexcept {
+        return !locked_.load(std::memory_order_relaxed) && !locked_.exchange(true, std::memory_order_acquire);
+    }
+    void unlock() noexcept { locked_.store(false, std::memory_order_release); }
+    /// @endcond
+
+private:
+    std::atomic<bool> locked_{false};
+};
+
+
+// --- Counter Policies ---
+/// @brief Counter policy treating `rand_a` and `rand_b` as one 74-bit counter
+///
+/// A new millisecond seeds the counter with random bits and each further UUID
+/// in the same millisecond increments it by one (RFC 9562 Section 6.2, Method 2).
+struct increment_counter {
+    /// @brief Seed the counter at the start of a new millisecond
+    /// @param rand_a `rand_a` field to seed
+    /// @param rand_b `rand_b` field to seed
+    /// @param entropy Entropy policy object
+    template <class Entropy>
+    void seed(std::uint16_t& rand_a, std::uint64_t& rand_b, Entropy& entropy) {
+        std::array<std::uint8_t, 10> rand = entropy();
+        rand_a = static_cast<std::uint16_t>((rand[0] << 8 | rand[1]) & uuidv7::MAX_RAND_A);
+        rand_b = 0;
+        for (int i = 2; i < 10; i++) rand_b = (rand_b << 8) | rand[i];
+        rand_b &= uuidv7::MAX_RAND_B;
+    }
+
+    /// @brief Increment the counter within the same millisecond
+    /// @param rand_a `rand_a` field to increment
+    /// @param rand_b `rand_b` field to increment
+    /// @throw sequence_overflow_error if the counter overflows
+    void increment(std::uint16_t& rand_a, std::uint64_t& rand_b) {
+        if (rand_b < uuidv7::MAX_RAND_B) {
+            rand_b++;
+            return;
+        }
+        if (rand_a < uuidv7::MAX_RAND_A) {
+            rand_a++;
+            rand_b = 0;
+            return;
+        }
+        throw sequence_overflow_error("Too many UUIDs generated in the same millisecond; sequence counter overflowed.");
+    }
+
+    /// @brief Advance the counter by `n` increments at once
+    /// @param rand_a `rand_a` field to advance
+    /// @param rand_b `rand_b` field to advance
+    /// @param n Number of increments
+    /// @throw sequence_overflow_error if the counter overflows (the fields are left unchanged)
+    void advance(std::uint16_t& rand_a, std::uint64_t& rand_b, std::uint64_t n) {
+        const std::uint64_t room = uuidv7::MAX_RAND_B - rand_b;
+        if (n <= room) {
+            rand_b += n;
+            return;
+        }
+        n -= room + 1; // Past the carry into rand_a
+        const std::uint64_t carry = 1 + n / (uuidv7::MAX_RAND_B + 1);
+        if (carry > static_cast<std::uint64_t>(uuidv7::MAX_RAND_A - rand_a))
+            throw sequence_overflow_error("Too many UUIDs generated in the same millisecond; sequence counter overflowed.");
+        rand_a = static_cast<std::uint16_t>(rand_a + carry);
+        rand_b = n % (uuidv7::MAX_RAND_B + 1);
+    }
+};
+
+/// @brief Counter policy embedding a fixed shard (node) identifier in `rand_b`
+///
+/// The top `shard_bits` bits of `rand_b` carry the shard identifier. The per-millisecond
+/// counter spans `rand_a` (upper part) and the remaining low bits of `rand_b` (lower part),
+/// so UUIDs from one shard stay monotonic and UUIDs from different shards never collide.
+/// The shard can be recovered from any UUID with `shard_of()` without a lookup.
+///
+/// With `no_entropy` the counter starts at zero every millisecond and no CSPRNG call is made.
+///
+/// @code
+/// using shard_generator = uuidv7::basic_uuidv7_generator<
+///     std::chrono::system_clock, uuidv7::no_entropy, std::mutex, uuidv7::shard_counter>;
+/// shard_generator generator({}, uuidv7::shard_counter(10, 42)); // 10-bit shard ID 42
+/// @endcode
+class shard_counter {
+public:
+    /// @brief Maximum number of shard bits (leaves at least 14 counter bits in `rand_b`)
+    static constexpr unsigned MAX_SHARD_BITS = 48;
+
+    /// @brief Create a new shard_counter object
+    /// @param shard_bits Number of bits used for the shard identifier (1 to `MAX_SHARD_BITS`)
+    /// @param shard_id Shard identifier (must fit in `shard_bits` bits)
+    /// @throw std::invalid_argument if `shard_bits` is out of range or `shard_id` does not fit
+    constexpr shard_counter(unsigned shard_bits, std::uint64_t shard_id)
+        : shard_bits_(shard_bits), shard_id_(shard_id)
+    {
+        if (shard_bits == 0 || shard_bits > MAX_SHARD_BITS)
+            throw std::invalid_argument("Shard bits must be between 1 and 48");
+        if (shard_id >> shard_bits != 0)
+            throw std::invalid_argument("Shard ID does not fit in the shard bits");
+    }
+
+    /// @brief Get the number of shard bits
+    /// @return Number of shard bits
+    constexpr unsigned shard_bits() const noexcept { return shard_bits_; }
+    /// @brief Get the shard identifier
+    /// @return Shard identifier
+    constexpr std::uint64_t shard_id() const noexcept { return shard_id_; }
+
+    /// @brief Extract the shard identifier from a `uuidv7` generated with this layout
+    /// @param uuid `uuidv7` object
+    /// @param shard_bits Number of shard bits used when generating `uuid`
+    /// @return Shard identifier
+    static constexpr std::uint64_t shard_of(const uuidv7& uuid, unsigned shard_bits) noexcept {
+        return uuid.rand_b() >> (62 - shard_bits);
+    }
+
+    /// @brief Extract the shard identifier from a `uuidv7` generated with this layout
+    /// @param uuid `uuidv7` object
+    /// @return Shard identifier
+    constexpr std::uint64_t shard_of(const uuidv7& uuid) const noexcept { return shard_of(uuid, shard_bits_); }
+
+    /// @brief Seed the counter at the start of a new millisecond
+    /// @param rand_a `rand_a` field to seed
+    /// @param rand_b `rand_b` field to seed
+    /// @param entropy Entropy policy object
+    template <class Entropy>
+    void seed(std::uint16_t& rand_a, std::uint64_t& rand_b, Entropy& entropy) {
+        std::array<std::uint8_t, 10> rand = entropy();
+        rand_a = static_cast<std::uint16_t>((rand[0] << 8 | rand[1]) & uuidv7::MAX_RAND_A);
+        std::uint64_t low = 0;
+        for (int i = 2; i < 10; i++) low = (low << 8) | rand[i];
+        rand_b = (shard_id_ << counter_bits()) | (low & counter_mask());
+    }
+
+    /// @brief Increment the counter within the same millisecond
+    /// @param rand_a `rand_a` field to increment
+    /// @param rand_b `rand_b` field to increment
+    /// @throw sequence_overflow_error if the counter overflows
+    void increment(std::uint16_t& rand_a, std::uint64_t& rand_b) {
+        if ((rand_b & counter_mask()) < counter_mask()) {
+            rand_b++;
+            return;
+        }
+        if (rand_a < uuidv7::MAX_RAND_A) {
+            rand_a++;
+            rand_b &= ~counter_mask();
+            return;
+        }
+        throw sequence_overflow_error("Too many UUIDs generated in the same millisecond; sequence counter overflowed.");
+    }
+
+    /// @brief Advance the counter by `n` increments at once
+    /// @param rand_a `rand_a` field to advance
+    /// @param rand_b `rand_b` field to advance
+    /// @param n Number of increments
+    /// @throw sequence_overflow_error if the counter overflows (the fields are left unchanged)
+    void advance(std::uint16_t& rand_a, std::uint64_t& rand_b, std::uint64_t n) {
+        const std::uint64_t room = counter_mask() - (rand_b & counter_mask());
+        if (n <= room) {
+            rand_b += n;
+            return;
+        }
+        n -= room + 1; // Past the carry into rand_a
+        const std::uint64_t carry = 1 + (n >> counter_bits());
+        if (carry > static_cast<std::uint64_t>(uuidv7::MAX_RAND_A - rand_a))
+            throw sequence_overflow_error("Too many UUIDs generated in the same millisecond; sequence counter overflowed.");
+        rand_a = static_cast<std::uint16_t>(rand_a + carry);
+        rand_b = (rand_b & ~counter_mask()) | (n & counter_mask());
+    }
+
+private:
+    unsigned shard_bits_;
+    std::uint64_t shard_id_;
+
+    constexpr unsigned counter_bits() const noexcept { return 62 - shard_bits_; }
+    constexpr std::uint64_t counter_mask() const noexcept { return (std::uint64_t(1) << counter_bits()) - 1; }
+};
+
+
+/// @cond Doxygen_suppress
+namespace detail {
+    template <class Entropy, class = void>
+    struct has_entropy_ready : std::false_type {};
+    template <class Entropy>
+    struct has_entropy_ready<Entropy, std::void_t<decltype(std::declval<Entropy&>().ready())>> : std::true_type {};
+
+    /// Entropy policies without `ready()` are assumed never to block
+    template <class Entropy>
+    bool entropy_ready(Entropy& entropy) noexcept {
+        if constexpr (has_entropy_ready<Entropy>::value) return entropy.ready();
+        else return true;
+    }
+
+    template <class CounterPolicy, class = void>
+    struct has_counter_advance : std::false_type {};
+    template <class CounterPolicy>
+    struct has_counter_advance<CounterPolicy, std::void_t<decltype(std::declval<CounterPolicy&>().advance(
+        std::declval<std::uint16_t&>(), std::declval<std::uint64_t&>(), std::uint64_t()))>> : std::true_type {};
+
+    /// Advance a counter by `n` increments; policies without `advance()` are incremented one by one
+    template <class CounterPolicy>
+    void advance_counter(CounterPolicy& counter, std::uint16_t& rand_a, std::uint64_t& rand_b, std::uint64_t n) {
+        if constexpr (has_counter_advance<CounterPolicy>::value) {
+            counter.advance(rand_a, rand_b, n);
+        } else {
+            std::uint16_t a = rand_a;
+            std::uint64_t b = rand_b;
+            for (; n > 0; n--) counter.increment(a, b);
+            rand_a = a;
+            rand_b = b;
+        }
+    }
+} // namespace detail
+/// @endcond
+
+/// @brief Block of consecutive `uuidv7` values reserved from a generator
+///
+/// Returned by `basic_uuidv7_generator::reserve()`. The values were taken from the generator
+/// under a single lock acquisition, so a worker thread can turn them into UUIDs without any
+/// synchronization. A lease is not thread-safe itself; give each worker its own.
+///
+/// All values share the timestamp of the `reserve()` call and are ordered by the counter,
+/// so they sort before anything the generator produces afterwards.
+/// @tparam CounterPolicy Counter policy of the generator
+template <class CounterPolicy>
+class uuidv7_lease {
+public:
+    /// @brief Get the next reserved `uuidv7`
+    /// @return `uuidv7` object
+    /// @throw std::out_of_range if the lease is exhausted
+    uuidv7 next() {
+        if (remaining_ == 0) throw std::out_of_range("uuidv7_lease is exhausted");
+        const uuidv7 uuid(unix_ts_ms_, rand_a_, rand_b_);
+        // The generator already advanced past the whole block, so this cannot overflow
+        if (--remaining_ > 0) counter_.increment(rand_a_, rand_b_);
+        return uuid;
+    }
+
+    /// @brief Get the number of values left
+    /// @return Number of `next()` calls that will succeed
+    std::size_t remaining() const noexcept { return remaining_; }
+    /// @brief Check whether the lease is exhausted
+    /// @return `true` if no values are left
+    bool empty() const noexcept { return remaining_ == 0; }
+    /// @brief Get the timestamp shared by the reserved values
+    /// @return Unix timestamp in milliseconds
+    std::uint64_t unix_ts_ms() const noexcept { return unix_ts_ms_; }
+
+private:
+    std::uint64_t unix_ts_ms_;
+    std::uint16_t rand_a_;
+    std::uint64_t rand_b_;
+    std::size_t remaining_;
+    CounterPolicy counter_;
+
+    uuidv7_lease(std::uint64_t unix_ts_ms, std::uint16_t rand_a, std::uint64_t rand_b, std::size_t count, CounterPolicy counter)
+        : unix_ts_ms_(unix_ts_ms), rand_a_(rand_a), rand_b_(rand_b), remaining_(count), counter_(std::move(counter)) {}
+
+    template <class Clock, class Entropy, class Lock, class Counter>
+    friend class basic_uuidv7_generator;
+};
+
+/// @brief Policy-based `uuidv7` generator class
 ///
-/// This class provides thread-safe generation of `uuidv7`.
 /// If multiple UUIDs are generated within the same millisecond,
-/// the random part is incremented to maintain monotonicity.
+/// the random part is advanced by `CounterPolicy` to maintain monotonicity.
+/// Each policy is stored by value, so an empty policy costs nothing.
+///
+/// @tparam Clock Clock type providing a static `now()` whose epoch is the Unix epoch
+/// @tparam Entropy Callable returning `std::array<std::uint8_t, 10>` of random bytes
+/// @tparam Lock Lockable type guarding the generator state (`null_lock` for single-thread use)
+/// @tparam CounterPolicy Type providing `seed(rand_a, rand_b, entropy)` and `increment(rand_a, rand_b)`,
+///         and optionally `advance(rand_a, rand_b, n)` to speed up `reserve()`
 ///
 /// @note
 /// This class maintains state (the last generated UUID).
 /// Typically, a single instance is shared within an application thread or process.
-class UUIDV7LIB_EXPORT uuidv7_generator {
+///
+/// @sa uuidv7_generator Default configuration
+template <class Clock, class Entropy, class Lock, class CounterPolicy>
+class basic_uuidv7_generator {
 public:
+    /// @brief Clock policy type
+    using clock_type = Clock;
+    /// @brief Entropy policy type
+    using entropy_type = Entropy;
+    /// @brief Lock policy type
+    using lock_type = Lock;
+    /// @brief Counter policy type
+    using counter_type = CounterPolicy;
+    /// @brief Lease type returned by `reserve()`
+    using lease_type = uuidv7_lease<CounterPolicy>;
+
     /// @brief Default constructor
-    uuidv7_generator() : last_generated_(0, 0, 0) {}
+    basic_uuidv7_generator() = default;
 
     /// @brief Constructor with initial last generated UUID
     /// @param last_uuid Initial last generated `uuidv7`
-    uuidv7_generator(uuidv7 last_uuid) : last_generated_(last_uuid) {}
+    basic_uuidv7_generator(uuidv7 last_uuid) {
+        static_assert(std::is_default_constructible<Entropy>::value && std::is_default_constructible<CounterPolicy>::value,
+                      "Policies without a default constructor need basic_uuidv7_generator(last_uuid, entropy, counter)");
+        set_last(last_uuid);
+    }
+
+    /// @brief Constructor with policy objects
+    /// @param entropy Entropy policy object
+    /// @param counter Counter policy object
+    basic_uuidv7_generator(Entropy entropy, CounterPolicy counter)
+        : entropy_(std::move(entropy)), counter_(std::move(counter)) {}
+
+    /// @brief Constructor with initial last generated UUID and policy objects
+    ///
+    /// Resumes a generator after a restart, e.g. a `shard_counter` generator from the last ID
+    /// its shard issued, so new UUIDs stay above it even within the same millisecond.
+    /// @param last_uuid Initial last generated `uuidv7` (generated with the same counter layout)
+    /// @param entropy Entropy policy object
+    /// @param counter Counter policy object
+    basic_uuidv7_generator(uuidv7 last_uuid, Entropy entropy, CounterPolicy counter)
+        : entropy_(std::move(entropy)), counter_(std::move(counter))
+    {
+        set_last(last_uuid);
+    }
 
     /// @cond Doxygen_suppress
     // Move constructor and move assignment operator
-    uuidv7_generator(uuidv7_generator&&) = default;
-    uuidv7_generator& operator=(uuidv7_generator&&) = default;
+    basic_uuidv7_generator(basic_uuidv7_generator&&) = default;
+    basic_uuidv7_generator& operator=(basic_uuidv7_generator&&) = default;
 
     // Delete copy constructor and copy assignment operator
-    uuidv7_generator(const uuidv7_generator&) = delete;
-    uuidv7_generator& operator=(const uuidv7_generator&) = delete;
+    basic_uuidv7_generator(const basic_uuidv7_generator&) = delete;
+    basic_uuidv7_generator& operator=(const basic_uuidv7_generator&) = delete;
     /// @endcond
 
-    /// @brief Get the default `uuidv7_generator` instance
-    /// @return Reference to the default `uuidv7_generator` instance
-    static uuidv7_generator& default_instance() {
-        static uuidv7_generator instance;
+    /// @brief Get the default instance of this generator type
+    /// @return Reference to the default instance
+    static basic_uuidv7_generator& default_instance() {
+        static_assert(std::is_default_constructible<basic_uuidv7_generator>::value,
+                      "default_instance() requires default-constructible policies");
+        static basic_uuidv7_generator instance;
         return instance;
     }
 
-    /// @brief Generate a new `uuidv7` object with the current time using the default `uuidv7_generator` instance
+    /// @brief Generate a new `uuidv7` object with the current time using the default instance
     /// @return `uuidv7` object
     /// @throw std::system_error if random number generation fails (OS-specific CSPRNG call fails)
     /// @throw std::runtime_error if random number generation fails (CSPRNG library call fails)
@@ -62,15 +482,166 @@ public:
     /// @throw std::system_error if random number generation fails (OS-specific CSPRNG call fails)
     /// @throw std::runtime_error if random number generation fails (CSPRNG library call fails)
     /// @throw sequence_overflow_error if the maximum number of UUIDs that can be generated in the same millisecond is exceeded
-    uuidv7 generate();
+    uuidv7 generate() {
+        std::lock_guard<Lock> lock(lock_);
+        return generate_unlocked(current_millis());
+    }
+
+    /// @brief Generate a new `uuidv7` object unless that would block
+    ///
+    /// Fails instead of waiting when the lock is held by another thread, or when a new
+    /// millisecond needs fresh random bits and the entropy policy is not `ready()`
+    /// (e.g. `getrandom` at early boot). Suitable for event loop threads.
+    /// @return `uuidv7` object, or `std::nullopt` if generating would block
+    /// @throw std::system_error if random number generation fails (OS-specific CSPRNG call fails)
+    /// @throw std::runtime_error if random number generation fails (CSPRNG library call fails)
+    /// @throw sequence_overflow_error if the maximum number of UUIDs that can be generated in the same millisecond is exceeded
+    std::optional<uuidv7> try_generate() {
+        std::unique_lock<Lock> lock(lock_, std::try_to_lock);
+        if (!lock.owns_lock()) return std::nullopt;
+        const std::uint64_t now_ms = current_millis();
+        if (now_ms > last_ms_ && !detail::entropy_ready(entropy_)) return std::nullopt;
+        return generate_unlocked(now_ms);
+    }
+
+    /// @brief Reserve a block of consecutive `uuidv7` values for a worker thread
+    ///
+    /// Takes the lock once and advances the counter past `count` values, which the returned
+    /// lease hands out with `next()` without synchronization. The values are exactly those
+    /// that `count` calls to `generate()` within the same millisecond would have returned.
+    /// @param count Number of values to reserve
+    /// @return Lease over the reserved values
+    /// @throw std::invalid_argument if `count` is zero
+    /// @throw std::system_error if random number generation fails (OS-specific CSPRNG call fails)
+    /// @throw std::runtime_error if random number generation fails (CSPRNG library call fails)
+    /// @throw sequence_overflow_error if `count` values do not fit in the counter of the current millisecond
+    ///        (the generator state is left unchanged)
+    lease_type reserve(std::size_t count) {
+        if (count == 0) throw std::invalid_argument("Lease count must be positive");
+        std::lock_guard<Lock> lock(lock_);
+        const std::uint64_t last_ms = last_ms_;
+        const std::uint16_t rand_a = rand_a_;
+        const std::uint64_t rand_b = rand_b_;
+        const uuidv7 first = generate_unlocked(current_millis());
+        try {
+            detail::advance_counter(counter_, rand_a_, rand_b_, count - 1);
+        } catch (...) {
+            last_ms_ = last_ms;
+            rand_a_ = rand_a;
+            rand_b_ = rand_b;
+            throw;
+        }
+        return lease_type(last_ms_, first.rand_a(), first.rand_b(), count, counter_);
+    }
+
+#if defined(UUIDV7LIB_COROUTINES)
+    /// @brief Awaitable returned by `async_generate()`
+    /// @tparam Executor Callable scheduling a nullary callable on another thread
+    template <class Executor>
+    class generate_awaitable {
+    public:
+        /// @cond Doxygen_suppress
+        generate_awaitable(basic_uuidv7_generator& generator, Executor executor)
+            : generator_(generator), executor_(std::move(executor)) {}
+
+        bool await_ready() {
+            try {
+                result_ = generator_.try_generate();
+            } catch (...) {
+                error_ = std::current_exception();
+            }
+            return result_.has_value() || error_;
+        }
+
+        void await_suspend(std::coroutine_handle<> handle) {
+            // The coroutine may resume and destroy this awaitable before the executor returns
+            Executor executor = std::move(executor_);
+            executor([this, handle] {
+                try {
+                    result_ = generator_.generate();
+                } catch (...) {
+                    error_ = std::current_exception();
+                }
+                handle.resume();
+            });
+        }
+
+        uuidv7 await_resume() {
+            if (error_) std::rethrow_exception(error_);
+            return *result_;
+        }
+        /// @endcond
+
+    private:
+        basic_uuidv7_generator& generator_;
+        Executor executor_;
+        std::optional<uuidv7> result_;
+        std::exception_ptr error_;
+    };
+
+    /// @brief Generate a new `uuidv7` object from a C++20 coroutine without blocking its thread
+    ///
+    /// `co_await generator.async_generate(executor)` completes without suspending whenever
+    /// `try_generate()` succeeds. Otherwise the blocking `generate()` is handed to `executor`,
+    /// and the coroutine resumes on the thread that runs it. With Asio, for example:
+    ///
+    /// @code
+    /// uuidv7::uuidv7 id = co_await generator.async_generate(
+    ///     [&](auto work) { asio::post(blocking_pool, std::move(work)); });
+    /// @endcode
+    /// @param executor Callable invoked as `executor(work)` to run `work()` on another thread,
+    ///        typically a bounded pool owned by the caller
+    /// @return Awaitable yielding the `uuidv7` object; rethrows the errors of `generate()`
+    /// @note Requires C++20 coroutines. The generator must outlive the awaiting coroutine.
+    template <class Executor>
+    generate_awaitable<Executor> async_generate(Executor executor) {
+        return generate_awaitable<Executor>(*this, std::move(executor));
+    }
+#endif
+
+    /// @brief Get the counter policy object
+    /// @return Reference to the counter policy object
+    const CounterPolicy& counter() const noexcept { return counter_; }
 
 private:
-    std::mutex mutex_;
-    uuidv7 last_generated_{0, 0, 0};
+    Lock lock_;
+    Entropy entropy_;
+    CounterPolicy counter_;
+    std::uint64_t last_ms_ = 0;
+    std::uint16_t rand_a_ = 0;
+    std::uint64_t rand_b_ = 0;
 
-    /// @brief Generate 10 random bytes with CSPRNG
-    /// @return 10-byte array of random bytes
-    std::array<std::uint8_t, 10> generate_random();
+    static std::uint64_t current_millis() {
+        auto now_duration = Clock::now().time_since_epoch();
+        auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(now_duration).count();
+        return static_cast<std::uint64_t>(millis) & 0xFFFFFFFFFFFF;
+    }
+
+    uuidv7 generate_unlocked(std::uint64_t now_ms) {
+        if (now_ms > last_ms_) {
+            counter_.seed(rand_a_, rand_b_, entropy_);
+            last_ms_ = now_ms;
+        } else {
+            counter_.increment(rand_a_, rand_b_);
+        }
+        return uuidv7(last_ms_, rand_a_, rand_b_);
+    }
+
+    void set_last(const uuidv7& last) noexcept {
+        last_ms_ = last.unix_ts_ms();
+        rand_a_ = last.rand_a();
+        rand_b_ = last.rand_b();
+    }
 };
 
+/// @brief Thread-safe `uuidv7` generator class
+///
+/// This is the default configuration of `basic_uuidv7_generator`:
+/// `std::chrono::system_clock`, the platform CSPRNG, `std::mutex` and a +1 counter.
+using uuidv7_generator = basic_uuidv7_generator<std::chrono::system_clock, csprng_entropy, std::mutex, increment_counter>;
+
+/// @cond Doxygen_suppress
+extern template class UUIDV7LIB_EXPORT basic_uuidv7_generator<std::chrono::system_clock, csprng_entropy, std::mutex, increment_counter>;
+/// @endcond
+
 } // namespace uuidv7
@@ -0,0 +1,138 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include "uuidv7.hpp"
+#include "view.hpp"
+
+namespace uuidv7 {
+
+/// @brief Read-only set of `uuidv7` stored in a memory-mapped file
+///
+/// The file holds the UUIDs sorted and deduplicated, as raw 16-byte values packed into
+/// fixed-size pages. A sparse index holds the first 8 bytes (`unix_ts_ms`, version and
+/// `rand_a`) of the first UUID of each page. A lookup binary searches the index, then
+/// searches within the pages it selects. Lookups and time-range scans read the mapped
+/// file directly. They do no deserialization and no heap allocation. Only the pages a
+/// query touches are loaded, so a set can be far larger than RAM.
+///
+/// | Section | Layout |
+/// |---------|--------|
+/// | header | magic `"U7S1"`, layout, UUID count, page size, page count, data offset (little-endian) |
+/// | sparse index | first 8 bytes of the first UUID of each page |
+/// | data (page-aligned) | sorted UUIDs, 16 bytes each in big-endian order |
+///
+/// @note Available on POSIX platforms only.
+class UUIDV7LIB_EXPORT uuidv7_mmap_set {
+public:
+    /// @brief Size of a data page in bytes
+    static constexpr std::size_t BYTES_PER_PAGE = 4096;
+    /// @brief Number of UUIDs per data page
+    static constexpr std::size_t UUIDS_PER_PAGE = BYTES_PER_PAGE / 16;
+
+    /// @brief Write a set file
+    ///
+    /// The file is written to a uniquely named temporary file next to `path` and renamed into
+    /// place after it is flushed, so readers never see a partially written set and concurrent
+    /// writers each replace the set with a whole file. The directory is flushed after the rename.
+    /// @param path Set file path
+    /// @param first Pointer to the first UUID
+    /// @param last Pointer past the last UUID
+    /// @throw std::system_error if the file cannot be written
+    /// @note The UUIDs need not be sorted or unique.
+    static void write(const std::string& path, const uuidv7* first, const uuidv7* last);
+
+    /// @brief Open a set file
+    /// @param path Set file path
+    /// @throw std::system_error if the file cannot be opened or mapped
+    /// @throw invalid_format_error if the file is not a valid set file
+    explicit uuidv7_mmap_set(const std::string& path);
+
+    /// @cond Doxygen_suppress
+    uuidv7_mmap_set(uuidv7_mmap_set&& other) noexcept;
+    uuidv7_mmap_set& operator=(uuidv7_mmap_set&& other) noexcept;
+    uuidv7_mmap_set(const uuidv7_mmap_set&) = delete;
+    uuidv7_mmap_set& operator=(const uuidv7_mmap_set&) = delete;
+
+    ~uuidv7_mmap_set();
+    /// @endcond
+
+    /// @brief Get the number of UUIDs
+    /// @return Number of UUIDs in the set
+    std::size_t size() const noexcept { return count_; }
+    /// @brief Check whether the set is empty
+    /// @return `true` if the set holds no UUID
+    bool empty() const noexcept { return count_ == 0; }
+
+    /// @brief Get the raw UUID data
+    /// @return Pointer to the sorted UUIDs, 16 bytes each, valid while the set is open
+    const std::uint8_t* data() const noexcept { return data_; }
+
+    /// @brief Get a view of a UUID by position without copying it
+    /// @param index Position in sorted order (must be less than `size()`)
+    /// @return View of the UUID bytes in the mapped file
+    uuidv7_view operator[](std::size_t index) const noexcept { return uuidv7_view(data_ + index * 16); }
+
+    /// @brief Get a UUID by position
+    /// @param index Position in sorted order
+    /// @return `uuidv7` object
+    /// @throw std::out_of_range if `index` is out of range
+    /// @throw invalid_format_error if the record is not a valid UUIDv7 (corrupted file; records are not validated on open)
+    uuidv7 at(std::size_t index) const;
+
+    /// @brief Find the position of the first UUID not less than `uuid`
+    /// @param uuid UUID to search
+    /// @return Position of the first UUID not less than `uuid`, or `size()`
+    std::size_t lower_bound(const uuidv7& uuid) const noexcept;
+
+    /// @brief Check whether `uuid` is in the set
+    /// @param uuid UUID to search
+    /// @return `true` if `uuid` is in the set
+    bool contains(const uuidv7& uuid) const noexcept;
+
+    /// @brief Find all UUIDs created between two time points (inclusive, millisecond granularity)
+    /// @param from Beginning of the time range
+    /// @param to End of the time range
+    /// @return Pair of positions delimiting the UUIDs with `from <= time_point() <= to`
+    /// @throw std::out_of_range if a time point is out of the UUID Version 7 timestamp range
+    template <class Duration1, class Duration2>
+    std::pair<std::size_t, std::size_t> find_range(
+        std::chrono::time_point<std::chrono::system_clock, Duration1> from,
+        std::chrono::time_point<std::chrono::system_clock, Duration2> to) const
+    {
+        std::uint64_t from_ms = uuidv7::min_for_time(from).unix_ts_ms();
+        std::uint64_t to_ms = uuidv7::max_for_time(to).unix_ts_ms();
+        if (from_ms > to_ms) return { count_, count_ };
+
+        std::size_t first = lower_bound(uuidv7::from_fields(from_ms, 0, 0));
+        std::size_t last = to_ms == 0xFFFFFFFFFFFF ? count_ : lower_bound(uuidv7::from_fields(to_ms + 1, 0, 0));
+        return { first, last };
+    }
+
+    /// @brief Count the UUIDs created between two time points (inclusive, millisecond granularity)
+    /// @param from Beginning of the time range
+    /// @param to End of the time range
+    /// @return Number of UUIDs with `from <= time_point() <= to`
+    /// @throw std::out_of_range if a time point is out of the UUID Version 7 timestamp range
+    template <class Duration1, class Duration2>
+    std::size_t count_range(
+        std::chrono::time_point<std::chrono::system_clock, Duration1> from,
+        std::chrono::time_point<std::chrono::system_clock, Duration2> to) const
+    {
+        auto range = find_range(from, to);
+        return range.second - range.first;
+    }
+
+private:
+    void* map_ = nullptr;
+    std::size_t map_size_ = 0;
+    const std::uint8_t* index_ = nullptr;
+    const std::uint8_t* data_ = nullptr;
+    std::size_t count_ = 0;
+    std::size_t page_count_ = 0;
+};
+
+} // namespace uuidv7
@@ -0,0 +1,252 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+#include "uuidv7.hpp"
+#include "view.hpp"
+
+#if __cpp_lib_span >= 202002L
+    #include <span>
+#endif
+
+namespace uuidv7 {
+
+/// @cond Doxygen_suppress
+namespace detail {
+    /// Jump consistent hash (Lamping and Veach): growing from n to n + 1 buckets moves only 1/(n + 1) of the keys
+    inline std::uint32_t jump_consistent_hash(std::uint64_t key, std::uint32_t buckets) noexcept {
+        std::int64_t b = -1, j = 0;
+        while (j < static_cast<std::int64_t>(buckets)) {
+            b = j;
+            key = key * 2862933555777941757ULL + 1;
+            j = static_cast<std::int64_t>(static_cast<double>(b + 1) *
+                                          (static_cast<double>(1LL << 31) / static_cast<double>((key >> 33) + 1)));
+        }
+        return static_cast<std::uint32_t>(b);
+    }
+
+    /// `jump_consistent_hash()` of 4 keys in lockstep: the lanes step without branches until the
+    /// last one is done, which overlaps their dependency chains and avoids a mispredicted loop exit per key
+    inline void jump_consistent_hash4(const std::uint64_t* keys, std::uint32_t buckets, std::uint32_t* out) noexcept {
+        std::uint64_t key[4];
+        std::int64_t b[4], j[4];
+        for (int l = 0; l < 4; l++) {
+            key[l] = keys[l];
+            b[l] = -1;
+            j[l] = 0;
+        }
+        const std::int64_t n = static_cast<std::int64_t>(buckets);
+        while (j[0] < n || j[1] < n || j[2] < n || j[3] < n) {
+            for (int l = 0; l < 4; l++) {
+                const bool active = j[l] < n;
+                const std::uint64_t next = key[l] * 2862933555777941757ULL + 1;
+                const std::int64_t jump = static_cast<std::int64_t>(static_cast<double>(j[l] + 1) *
+                                          (static_cast<double>(1LL << 31) / static_cast<double>((next >> 33) + 1)));
+                b[l] = active ? j[l] : b[l];
+                key[l] = active ? next : key[l];
+                j[l] = active ? jump : j[l];
+            }
+        }
+        for (int l = 0; l < 4; l++) out[l] = static_cast<std::uint32_t>(b[l]);
+    }
+
+    /// Number of shard indexes computed per pass of `partition_uuids()` (kept in L1 with the input chunk)
+    constexpr std::size_t PARTITION_CHUNK = 1024;
+} // namespace detail
+/// @endcond
+
+/// @brief Partitioner assigning `uuidv7` to shards by time bucket
+///
+/// The shard of a UUID is `(unix_ts_ms / bucket) % shard_count`, so consecutive buckets
+/// rotate over the shards, e.g. for time-partitioned tables.
+class uuidv7_time_partitioner {
+public:
+    /// @brief Create a partitioner
+    /// @param shard_count Number of shards
+    /// @param bucket Time span of a bucket
+    /// @throw std::invalid_argument if `shard_count` or `bucket` is not positive
+    uuidv7_time_partitioner(std::size_t shard_count, std::chrono::milliseconds bucket)
+        : shard_count_(shard_count), bucket_ms_(static_cast<std::uint64_t>(bucket.count()))
+    {
+        if (shard_count == 0 || shard_count > 0xFFFFFFFFU) throw std::invalid_argument("Invalid shard count");
+        if (bucket.count() <= 0) throw std::invalid_argument("Partition bucket must be positive");
+    }
+
+    /// @brief Get the shard of a UUID
+    /// @param uuid UUID
+    /// @return Shard index in `[0, shard_count())`
+    std::size_t operator()(const uuidv7& uuid) const noexcept {
+        return static_cast<std::size_t>((uuid.unix_ts_ms() / bucket_ms_) % shard_count_);
+    }
+
+    /// @brief Get the shards of consecutive UUIDs
+    ///
+    /// Batches are mostly in time order, so the shard is only recomputed when a UUID leaves
+    /// the bucket of the previous one.
+    /// @param first Pointer to the first UUID
+    /// @param count Number of UUIDs
+    /// @param shards Output shard indexes (`count` elements)
+    void shards(const uuidv7* first, std::size_t count, std::uint32_t* shards) const noexcept {
+        std::uint64_t begin = 0, end = 0; // Time range of the cached bucket (none yet)
+        std::uint32_t shard = 0;
+        for (std::size_t i = 0; i < count; i++) {
+            const std::uint64_t ts = first[i].unix_ts_ms();
+            if (ts - begin >= end - begin) {
+                const std::uint64_t bucket = ts / bucket_ms_;
+                begin = bucket * bucket_ms_;
+                end = begin + bucket_ms_;
+                shard = static_cast<std::uint32_t>(bucket % shard_count_);
+            }
+            shards[i] = shard;
+        }
+    }
+
+    /// @brief Get the number of shards
+    /// @return Number of shards
+    std::size_t shard_count() const noexcept { return shard_count_; }
+    /// @brief Get the time span of a bucket
+    /// @return Bucket time span
+    std::chrono::milliseconds bucket() const noexcept { return std::chrono::milliseconds(bucket_ms_); }
+
+private:
+    std::size_t shard_count_;
+    std::uint64_t bucket_ms_;
+};
+
+/// @brief Partitioner spreading `uuidv7` uniformly over shards with jump consistent hashing
+///
+/// The UUID is hashed like in `uuidv7_flat_hash` (counter policies make consecutive `rand_b`
+/// values differ only in their low bits) and mapped with jump consistent hashing, so growing
+/// from n to n + 1 shards moves only 1/(n + 1) of the UUIDs, all of them to the new shard.
+class uuidv7_hash_partitioner {
+public:
+    /// @brief Create a partitioner
+    /// @param shard_count Number of shards
+    /// @throw std::invalid_argument if `shard_count` is zero or greater than 2^31
+    explicit uuidv7_hash_partitioner(std::size_t shard_count) : shard_count_(shard_count) {
+        if (shard_count == 0 || shard_count > 0x80000000U) throw std::invalid_argument("Invalid shard count");
+    }
+
+    /// @brief Get the shard of a UUID
+    /// @param uuid UUID
+    /// @return Shard index in `[0, shard_count())`
+    std::size_t operator()(const uuidv7& uuid) const noexcept {
+        return detail::jump_consistent_hash(detail::mix_hash_bytes(uuidv7_view(uuid).data()),
+                                            static_cast<std::uint32_t>(shard_count_));
+    }
+
+    /// @brief Get the shards of consecutive UUIDs
+    /// @param first Pointer to the first UUID
+    /// @param count Number of UUIDs
+    /// @param shards Output shard indexes (`count` elements)
+    void shards(const uuidv7* first, std::size_t count, std::uint32_t* shards) const noexcept {
+        const auto buckets = static_cast<std::uint32_t>(shard_count_);
+        std::size_t i = 0;
+        for (; i + 4 <= count; i += 4) {
+            std::uint64_t keys[4];
+            for (int l = 0; l < 4; l++) keys[l] = detail::mix_hash_bytes(uuidv7_view(first[i + l]).data());
+            detail::jump_consistent_hash4(keys, buckets, shards + i);
+        }
+        for (; i < count; i++) shards[i] = static_cast<std::uint32_t>((*this)(first[i]));
+    }
+
+    /// @brief Get the number of shards
+    /// @return Number of shards
+    std::size_t shard_count() const noexcept { return shard_count_; }
+
+private:
+    std::size_t shard_count_;
+};
+
+/// @brief Partition `uuidv7` values into one contiguous range per shard
+///
+/// A counting scatter: shard indexes are computed in chunks by the partitioner, counted,
+/// and each UUID is written once to its shard's range. The order within a shard is kept.
+///
+/// @tparam Partitioner `uuidv7_time_partitioner`, `uuidv7_hash_partitioner` or a type with the same
+///         `shard_count()` and `shards(first, count, shards)` members
+/// @param first Pointer to the first UUID
+/// @param last Pointer past the last UUID
+/// @param out Output buffer (must hold `last - first` elements and not overlap the input)
+/// @param partitioner Partitioner
+/// @return Offsets of the shards in `out` (`shard_count() + 1` elements): shard `s` is `[offsets[s], offsets[s + 1])`
+template <class Partitioner>
+std::vector<std::size_t> partition_uuids(const uuidv7* first, const uuidv7* last, uuidv7* out, const Partitioner& partitioner) {
+    const auto n = static_cast<std::size_t>(last - first);
+    const std::size_t shard_count = partitioner.shard_count();
+    std::vector<std::uint32_t> shards(n);
+    std::vector<std::size_t> offsets(shard_count + 1, 0);
+    for (std::size_t i = 0; i < n; i += detail::PARTITION_CHUNK) {
+        const std::size_t count = std::min(detail::PARTITION_CHUNK, n - i);
+        partitioner.shards(first + i, count, shards.data() + i);
+        for (std::size_t j = i; j < i + count; j++) offsets[shards[j] + 1]++;
+    }
+    for (std::size_t s = 0; s < shard_count; s++) offsets[s + 1] += offsets[s];
+
+    std::vector<std::size_t> next(offsets.begin(), offsets.end() - 1);
+    for (std::size_t i = 0; i < n; i++) out[next[shards[i]]++] = first[i];
+    return offsets;
+}
+
+/// @brief Append `uuidv7` values to per-shard buffers
+///
+/// Shard indexes are computed in chunks by the partitioner; each chunk is counted first,
+/// so every buffer grows at most once per chunk and the UUIDs are then appended without reallocation.
+///
+/// @tparam Partitioner `uuidv7_time_partitioner`, `uuidv7_hash_partitioner` or a type with the same
+///         `shard_count()` and `shards(first, count, shards)` members
+/// @param first Pointer to the first UUID
+/// @param last Pointer past the last UUID
+/// @param partitioner Partitioner
+/// @param buffers Per-shard buffers, resized to `shard_count()` elements if smaller; existing contents are kept
+template <class Partitioner>
+void partition_uuids(const uuidv7* first, const uuidv7* last, const Partitioner& partitioner,
+                     std::vector<std::vector<uuidv7>>& buffers)
+{
+    const auto n = static_cast<std::size_t>(last - first);
+    const std::size_t shard_count = partitioner.shard_count();
+    if (buffers.size() < shard_count) buffers.resize(shard_count);
+    std::uint32_t shards[detail::PARTITION_CHUNK];
+    std::vector<std::size_t> counts(shard_count);
+    for (std::size_t i = 0; i < n; i += detail::PARTITION_CHUNK) {
+        const std::size_t count = std::min(detail::PARTITION_CHUNK, n - i);
+        partitioner.shards(first + i, count, shards);
+        std::fill(counts.begin(), counts.end(), std::size_t(0));
+        for (std::size_t j = 0; j < count; j++) counts[shards[j]]++;
+        for (std::size_t s = 0; s < shard_count; s++) {
+            std::vector<uuidv7>& buffer = buffers[s];
+            const std::size_t needed = buffer.size() + counts[s];
+            if (needed > buffer.capacity()) buffer.reserve(std::max(needed, buffer.capacity() * 2));
+        }
+        for (std::size_t j = 0; j < count; j++) buffers[shards[j]].push_back(first[i + j]);
+    }
+}
+
+#if __cpp_lib_span >= 202002L
+/// @brief Partition `uuidv7` values into one contiguous range per shard
+/// @param uuids UUIDs to partition
+/// @param out Output buffer (must hold `uuids.size()` elements and not overlap the input)
+/// @param partitioner Partitioner
+/// @return Offsets of the shards in `out` (`shard_count() + 1` elements)
+/// @sa partition_uuids(const uuidv7*, const uuidv7*, uuidv7*, const Partitioner&)
+template <class Partitioner>
+std::vector<std::size_t> partition_uuids(std::span<const uuidv7> uuids, uuidv7* out, const Partitioner& partitioner) {
+    return partition_uuids(uuids.data(), uuids.data() + uuids.size(), out, partitioner);
+}
+
+/// @brief Append `uuidv7` values to per-shard buffers
+/// @param uuids UUIDs to partition
+/// @param partitioner Partitioner
+/// @param buffers Per-shard buffers, resized to `shard_count()` elements if smaller
+/// @sa partition_uuids(const uuidv7*, const uuidv7*, const Partitioner&, std::vector<std::vector<uuidv7>>&)
+template <class Partitioner>
+void partition_uuids(std::span<const uuidv7> uuids, const Partitioner& partitioner, std::vector<std::vector<uuidv7>>& buffers) {
+    partition_uuids(uuids.data(), uuids.data() + uuids.size(), partitioner, buffers);
+}
+#endif
+
+} // namespace uuidv7
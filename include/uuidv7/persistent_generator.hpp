@@ -0,0 +1,68 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include "uuidv7.hpp"
+#include "generator.hpp"
+
+namespace uuidv7 {
+
+/// @brief `uuidv7` generator that checkpoints a high-water mark to a state file
+///
+/// Before a UUID with a timestamp at or above the persisted high-water mark is returned,
+/// the mark is advanced to `timestamp + interval` and flushed to disk.
+/// After a crash or restart (even onto a host whose clock lags behind),
+/// the generator resumes at the persisted mark, so every new UUID is strictly greater
+/// than any UUID emitted before. The file is written at most once per `interval`,
+/// so the per-UUID cost is a single comparison.
+///
+/// The state file is locked for exclusive use while the generator is alive.
+///
+/// @note Available on POSIX platforms only.
+class UUIDV7LIB_EXPORT persistent_uuidv7_generator {
+public:
+    /// @brief Open (or create) a generator backed by a state file
+    /// @param path State file path
+    /// @param interval How far ahead of the current timestamp the high-water mark is placed (default: 1 second)
+    /// @throw std::system_error if the state file cannot be opened, locked or mapped
+    /// @throw std::runtime_error if the state file has an incompatible format
+    explicit persistent_uuidv7_generator(const std::string& path,
+                                         std::chrono::milliseconds interval = std::chrono::seconds(1));
+
+    /// @cond Doxygen_suppress
+    // Delete copy/move constructor and copy/move assignment operator
+    persistent_uuidv7_generator(const persistent_uuidv7_generator&) = delete;
+    persistent_uuidv7_generator& operator=(const persistent_uuidv7_generator&) = delete;
+
+    ~persistent_uuidv7_generator();
+    /// @endcond
+
+    /// @brief Generate a new `uuidv7` object with the current time
+    /// @return `uuidv7` object
+    /// @throw std::system_error if random number generation fails (OS-specific CSPRNG call fails)
+    /// @throw std::system_error if the high-water mark cannot be flushed to the state file
+    /// @throw std::runtime_error if random number generation fails (CSPRNG library call fails)
+    /// @throw sequence_overflow_error if the maximum number of UUIDs that can be generated in the same millisecond is exceeded
+    uuidv7 generate();
+
+    /// @brief Get the persisted high-water mark
+    /// @return Unix timestamp in milliseconds that every future UUID is at or above
+    std::uint64_t high_water_mark() const;
+
+private:
+    struct checkpoint;
+
+    using generator_type = basic_uuidv7_generator<std::chrono::system_clock, csprng_entropy, null_lock, increment_counter>;
+
+    mutable std::mutex mutex_;
+    generator_type generator_;
+    checkpoint* checkpoint_ = nullptr;
+    int fd_ = -1;
+    std::uint64_t interval_ms_;
+
+    void persist(std::uint64_t high_water_ms);
+};
+
+} // namespace uuidv7
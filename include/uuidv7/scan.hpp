@@ -0,0 +1,180 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include "uuidv7.hpp"
+#include "detail/bits.hpp"
+
+namespace uuidv7 {
+
+/// @cond Doxygen_suppress
+namespace detail {
+    /// Length of a hyphenated UUID string
+    constexpr std::size_t UUID_TEXT_LENGTH = 36;
+
+    inline bool is_hex(char c) noexcept { return HEX_DECODE[static_cast<unsigned char>(c)] != 0xFF; }
+
+    /// Check one candidate start `s` (with `s + 36 <= text.size()`) and report it if it is a UUIDv7 token.
+    /// The text edges count as token boundaries; `prev` is the character before `text[0]` (non-hex if none).
+    template <class Callback>
+    bool scan_candidate(std::string_view text, std::size_t s, char prev, std::uint64_t base, Callback& callback) {
+        char before = s > 0 ? text[s - 1] : prev;
+        if (is_hex(before)) return false;
+        if (s + UUID_TEXT_LENGTH < text.size() && is_hex(text[s + UUID_TEXT_LENGTH])) return false;
+        auto ex = uuidv7::parse_ex(text.substr(s, UUID_TEXT_LENGTH));
+        if (!ex) return false;
+        callback(ex.value, base + s);
+        return true;
+    }
+
+    /// Report the UUIDv7 tokens of `text` starting in `[first, last)` (with `last + 35 <= text.size()`).
+    /// A start is a candidate if it has hyphens at +8, +13, +18 and +23 and the version digit '7' at +14.
+    /// With SSE2, these 5 checks are done for 16 starts at once with unaligned loads at the shifted offsets.
+    template <class Callback>
+    std::size_t scan_uuids(std::string_view text, std::size_t first, std::size_t last, char prev,
+                           std::uint64_t base, Callback& callback)
+    {
+        std::size_t found = 0;
+        std::size_t s = first;
+        const char* p = text.data();
+#if defined(UUIDV7LIB_SSE2)
+        const __m128i hyphen = _mm_set1_epi8('-');
+        const __m128i seven = _mm_set1_epi8('7');
+        auto eq = [&](std::size_t at, __m128i c) {
+            return _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + at)), c);
+        };
+        for (; s + 16 <= last; s += 16) {
+            __m128i m = _mm_and_si128(_mm_and_si128(eq(s + 8, hyphen), eq(s + 13, hyphen)),
+                                      _mm_and_si128(_mm_and_si128(eq(s + 18, hyphen), eq(s + 23, hyphen)), eq(s + 14, seven)));
+            std::uint32_t mask = static_cast<std::uint32_t>(_mm_movemask_epi8(m));
+            for (; mask; mask &= mask - 1)
+                found += scan_candidate(text, s + count_trailing_zeros(mask), prev, base, callback);
+        }
+#endif
+        while (s < last) {
+            // Jump to the next hyphen that could be the first separator
+            const void* next = std::memchr(p + s + 8, '-', last - s);
+            if (!next) break;
+            s = static_cast<std::size_t>(static_cast<const char*>(next) - p) - 8;
+            if (p[s + 13] == '-' && p[s + 18] == '-' && p[s + 23] == '-' && p[s + 14] == '7')
+                found += scan_candidate(text, s, prev, base, callback);
+            s++;
+        }
+        return found;
+    }
+} // namespace detail
+/// @endcond
+
+/// @brief Find the UUIDv7 tokens in a text
+///
+/// Locates hyphenated UUID strings (in either case) whose version digit is `7`, validates
+/// them with the rules of `uuidv7::parse()` and reports each valid one. A token must not be
+/// adjacent to another hex digit, so UUIDs embedded in longer hex runs are not reported.
+/// @param text Text to scan
+/// @param callback Called as `callback(const uuidv7&, std::uint64_t offset)` for each token, in order
+/// @return Number of tokens found
+/// @sa uuidv7_scanner Scanner for text arriving in chunks
+template <class Callback>
+std::size_t find_uuids(std::string_view text, Callback&& callback) {
+    if (text.size() < detail::UUID_TEXT_LENGTH) return 0;
+    return detail::scan_uuids(text, 0, text.size() - detail::UUID_TEXT_LENGTH + 1, ' ', 0, callback);
+}
+
+/// @brief Scanner finding UUIDv7 tokens in a text that arrives in chunks
+///
+/// Reports the same tokens as `find_uuids()` on the concatenated text, including tokens
+/// split across chunks. Offsets are relative to the beginning of the stream. Only the
+/// last 37 characters are kept between chunks; the chunks themselves are scanned in place.
+///
+/// @code
+/// uuidv7::uuidv7_scanner scanner;
+/// while (read_chunk(buffer)) scanner.feed(buffer, on_uuid);
+/// scanner.finish(on_uuid);
+/// @endcode
+class uuidv7_scanner {
+public:
+    /// @brief Scan the next chunk of the stream
+    /// @param chunk Next chunk (need not outlive the call)
+    /// @param callback Called as `callback(const uuidv7&, std::uint64_t offset)` for each token
+    /// @return Number of tokens found
+    /// @note Tokens ending within the last character of the chunk are reported by the next call or `finish()`.
+    template <class Callback>
+    std::size_t feed(std::string_view chunk, Callback&& callback) {
+        std::size_t found = 0;
+
+        // Starts left undecided by the previous chunks, continued into this one
+        if (tail_size_ > 0 && !chunk.empty()) {
+            char junction[TAIL_CAPACITY * 2];
+            std::size_t head = std::min(chunk.size(), TAIL_CAPACITY);
+            std::memcpy(junction, tail_, tail_size_);
+            std::memcpy(junction + tail_size_, chunk.data(), head);
+            std::string_view text(junction, tail_size_ + head);
+            std::size_t last = std::min(tail_size_, text.size() - std::min(text.size(), detail::UUID_TEXT_LENGTH));
+            for (std::size_t s = pending_first(); s < last; s++)
+                found += scan_one(text, s, callback);
+        }
+
+        // Starts within this chunk, whose following character is also within it
+        if (chunk.size() > detail::UUID_TEXT_LENGTH) {
+            char prev = tail_size_ > 0 ? tail_[tail_size_ - 1] : ' ';
+            found += detail::scan_uuids(chunk, 0, chunk.size() - detail::UUID_TEXT_LENGTH, prev, total_, callback);
+        }
+
+        // Keep the characters needed by the last undecided starts
+        total_ += chunk.size();
+        if (chunk.size() >= TAIL_CAPACITY) {
+            std::memcpy(tail_, chunk.data() + chunk.size() - TAIL_CAPACITY, TAIL_CAPACITY);
+            tail_size_ = TAIL_CAPACITY;
+        } else {
+            std::size_t keep = std::min(tail_size_, TAIL_CAPACITY - chunk.size());
+            std::memmove(tail_, tail_ + tail_size_ - keep, keep);
+            std::memcpy(tail_ + keep, chunk.data(), chunk.size());
+            tail_size_ = keep + chunk.size();
+        }
+        return found;
+    }
+
+    /// @brief Finish the stream and reset the scanner
+    /// @param callback Called as `callback(const uuidv7&, std::uint64_t offset)` for each token
+    /// @return Number of tokens found at the end of the stream
+    template <class Callback>
+    std::size_t finish(Callback&& callback) {
+        std::size_t found = 0;
+        std::string_view text(tail_, tail_size_);
+        if (text.size() >= detail::UUID_TEXT_LENGTH) {
+            std::size_t last = text.size() - detail::UUID_TEXT_LENGTH + 1;
+            for (std::size_t s = pending_first(); s < last; s++)
+                found += scan_one(text, s, callback);
+        }
+        tail_size_ = 0;
+        total_ = 0;
+        return found;
+    }
+
+    /// @brief Get the number of characters fed since the beginning of the stream
+    /// @return Stream offset of the next chunk
+    std::uint64_t offset() const noexcept { return total_; }
+
+private:
+    /// One leading character plus the 36 characters of the last undecided start
+    static constexpr std::size_t TAIL_CAPACITY = detail::UUID_TEXT_LENGTH + 1;
+
+    char tail_[TAIL_CAPACITY] = {};
+    std::size_t tail_size_ = 0;
+    std::uint64_t total_ = 0;
+
+    /// First undecided start in `tail_` (the first character is only context once the stream is long enough)
+    std::size_t pending_first() const noexcept { return total_ >= TAIL_CAPACITY ? 1 : 0; }
+
+    template <class Callback>
+    std::size_t scan_one(std::string_view text, std::size_t s, Callback& callback) {
+        if (text[s + 8] != '-' || text[s + 13] != '-' || text[s + 18] != '-' || text[s + 23] != '-' || text[s + 14] != '7')
+            return 0;
+        return detail::scan_candidate(text, s, ' ', total_ - tail_size_, callback);
+    }
+};
+
+} // namespace uuidv7
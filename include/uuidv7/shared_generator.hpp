@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include "uuidv7.hpp"
+#include "generator.hpp"
+
+namespace uuidv7 {
+
+/// @brief Multi-process `uuidv7` generator whose state lives in shared memory
+///
+/// All processes that open the same shared memory object (or file) draw from one
+/// monotonic sequence, which is useful for pre-fork worker pools.
+/// The shared state is a single 64-bit word (48-bit timestamp + 16-bit sequence)
+/// updated with a compare-and-swap loop, so there is no lock to be left held by
+/// a process that dies while generating.
+///
+/// The sequence occupies `rand_a` and the top 4 bits of `rand_b`;
+/// the remaining 58 bits of `rand_b` are filled by the CSPRNG once per millisecond per thread.
+/// Up to 65536 UUIDs can be generated per millisecond across all processes.
+///
+/// @note Available on POSIX platforms only.
+class UUIDV7LIB_EXPORT shared_uuidv7_generator {
+public:
+    /// @brief Open (or create) a generator backed by a POSIX shared memory object
+    /// @param name Shared memory object name (e.g. `"/myapp-uuidv7"`)
+    /// @return `shared_uuidv7_generator` object
+    /// @throw std::system_error if the shared memory object cannot be opened or mapped
+    /// @throw std::runtime_error if the object contains an incompatible state layout
+    static shared_uuidv7_generator open_shared_memory(const std::string& name);
+
+    /// @brief Open (or create) a generator backed by a regular file
+    /// @param path File path (e.g. a file on tmpfs)
+    /// @return `shared_uuidv7_generator` object
+    /// @throw std::system_error if the file cannot be opened or mapped
+    /// @throw std::runtime_error if the file contains an incompatible state layout
+    static shared_uuidv7_generator open_file(const std::string& path);
+
+    /// @brief Remove a shared memory object created by `open_shared_memory()`
+    /// @param name Shared memory object name
+    /// @return `true` if the object was removed
+    /// @note Processes that still have it open keep using the existing state.
+    static bool remove_shared_memory(const std::string& name) noexcept;
+
+    /// @cond Doxygen_suppress
+    // Move constructor and move assignment operator
+    shared_uuidv7_generator(shared_uuidv7_generator&& other) noexcept;
+    shared_uuidv7_generator& operator=(shared_uuidv7_generator&& other) noexcept;
+
+    // Delete copy constructor and copy assignment operator
+    shared_uuidv7_generator(const shared_uuidv7_generator&) = delete;
+    shared_uuidv7_generator& operator=(const shared_uuidv7_generator&) = delete;
+
+    ~shared_uuidv7_generator();
+    /// @endcond
+
+    /// @brief Generate a new `uuidv7` object with the current time
+    /// @return `uuidv7` object
+    /// @throw std::system_error if random number generation fails (OS-specific CSPRNG call fails)
+    /// @throw std::runtime_error if random number generation fails (CSPRNG library call fails)
+    /// @throw sequence_overflow_error if the maximum number of UUIDs that can be generated in the same millisecond is exceeded
+    uuidv7 generate();
+
+private:
+    struct shared_state;
+
+    shared_state* state_ = nullptr;
+    csprng_entropy entropy_;
+
+    explicit shared_uuidv7_generator(int fd);
+};
+
+} // namespace uuidv7
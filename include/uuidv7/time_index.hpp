@@ -0,0 +1,191 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "uuidv7.hpp"
+
+#if __cpp_lib_bitops >= 201907L
+    #include <bit>
+#endif
+#if defined(_MSC_VER) && !defined(__clang__)
+    #include <intrin.h>
+#endif
+
+namespace uuidv7 {
+
+/// @brief Sorted, immutable collection of `uuidv7` answering time-range queries
+///
+/// The UUIDs are kept in a sorted array, and the upper 64 bits of each UUID
+/// (`unix_ts_ms`, version and `rand_a`) are additionally laid out in Eytzinger
+/// (breadth-first) order. A lower bound search walks that array branch-free from
+/// the root, prefetching the descendants four levels ahead, so each step touches
+/// at most one new cache line and the search does not suffer branch mispredictions.
+///
+/// Time-range queries only need the upper 64 bits, since `min_for_time()` and
+/// `max_for_time()` of a millisecond differ from every other millisecond there.
+///
+/// Memory: 28 bytes per UUID (the 16-byte UUID, the 8-byte tree node and a 4-byte sorted
+/// position), or 32 bytes per UUID from 2^32 UUIDs on, e.g. about 1.1 GB for 40 million IDs.
+class uuidv7_time_index {
+public:
+    /// @brief Iterator type over the sorted UUIDs
+    using const_iterator = std::vector<uuidv7>::const_iterator;
+
+    /// @brief Create an empty index
+    uuidv7_time_index() = default;
+
+    /// @brief Create an index from a collection of UUIDs
+    /// @param uuids UUIDs to index (sorted here if they are not already sorted)
+    explicit uuidv7_time_index(std::vector<uuidv7> uuids) : sorted_(std::move(uuids)) {
+        if (!std::is_sorted(sorted_.begin(), sorted_.end()))
+            std::sort(sorted_.begin(), sorted_.end());
+        build();
+    }
+
+    /// @brief Create an index from a range of UUIDs
+    /// @param first Beginning of the range
+    /// @param last End of the range
+    template <class InputIt>
+    uuidv7_time_index(InputIt first, InputIt last) : uuidv7_time_index(std::vector<uuidv7>(first, last)) {}
+
+    /// @brief Get the number of indexed UUIDs
+    /// @return Number of UUIDs
+    std::size_t size() const noexcept { return sorted_.size(); }
+    /// @brief Check whether the index is empty
+    /// @return `true` if no UUID is indexed
+    bool empty() const noexcept { return sorted_.empty(); }
+
+    /// @brief Get an iterator to the smallest UUID
+    /// @return Iterator to the beginning of the sorted UUIDs
+    const_iterator begin() const noexcept { return sorted_.begin(); }
+    /// @brief Get an iterator past the largest UUID
+    /// @return Iterator to the end of the sorted UUIDs
+    const_iterator end() const noexcept { return sorted_.end(); }
+
+    /// @brief Find the first UUID not less than `uuid`
+    /// @param uuid UUID to search
+    /// @return Iterator to the first UUID not less than `uuid`, or `end()`
+    const_iterator lower_bound(const uuidv7& uuid) const noexcept {
+        auto first = begin() + static_cast<std::ptrdiff_t>(lower_bound_upper64(upper64(uuid)));
+        // Only UUIDs sharing the upper 64 bits remain to be compared
+        auto last = begin() + static_cast<std::ptrdiff_t>(lower_bound_upper64(upper64(uuid) + 1));
+        return std::lower_bound(first, last, uuid);
+    }
+
+    /// @brief Check whether `uuid` is indexed
+    /// @param uuid UUID to search
+    /// @return `true` if `uuid` is indexed
+    bool contains(const uuidv7& uuid) const noexcept {
+        auto it = lower_bound(uuid);
+        return it != end() && *it == uuid;
+    }
+
+    /// @brief Find all UUIDs created between two time points (inclusive, millisecond granularity)
+    /// @param from Beginning of the time range
+    /// @param to End of the time range
+    /// @return Pair of iterators delimiting the UUIDs with `from <= time_point() <= to`
+    /// @throw std::out_of_range if a time point is out of the UUID Version 7 timestamp range
+    template <class Duration1, class Duration2>
+    std::pair<const_iterator, const_iterator> find_range(
+        std::chrono::time_point<std::chrono::system_clock, Duration1> from,
+        std::chrono::time_point<std::chrono::system_clock, Duration2> to) const
+    {
+        std::uint64_t from_ms = uuidv7::min_for_time(from).unix_ts_ms();
+        std::uint64_t to_ms = uuidv7::max_for_time(to).unix_ts_ms();
+        if (from_ms > to_ms) return { end(), end() };
+
+        auto first = begin() + static_cast<std::ptrdiff_t>(lower_bound_upper64(from_ms << 16));
+        auto last = to_ms == 0xFFFFFFFFFFFF ? end() : begin() + static_cast<std::ptrdiff_t>(lower_bound_upper64((to_ms + 1) << 16));
+        return { first, last };
+    }
+
+    /// @brief Count the UUIDs created between two time points (inclusive, millisecond granularity)
+    /// @param from Beginning of the time range
+    /// @param to End of the time range
+    /// @return Number of UUIDs with `from <= time_point() <= to`
+    /// @throw std::out_of_range if a time point is out of the UUID Version 7 timestamp range
+    template <class Duration1, class Duration2>
+    std::size_t count_range(
+        std::chrono::time_point<std::chrono::system_clock, Duration1> from,
+        std::chrono::time_point<std::chrono::system_clock, Duration2> to) const
+    {
+        auto range = find_range(from, to);
+        return static_cast<std::size_t>(range.second - range.first);
+    }
+
+private:
+    std::vector<uuidv7> sorted_;
+    // 1-based Eytzinger layout of the upper 64 bits, and the sorted position of each node
+    // (32-bit positions unless there are too many UUIDs for them)
+    std::vector<std::uint64_t> tree_;
+    std::vector<std::uint32_t> position32_;
+    std::vector<std::size_t> position_;
+
+    static std::uint64_t upper64(const uuidv7& uuid) noexcept {
+        return detail::load_be64(uuid.get_bytes().data());
+    }
+
+    void build() {
+        tree_.assign(sorted_.size() + 1, 0);
+        if (sorted_.size() < 0xFFFFFFFFU) position32_.assign(sorted_.size() + 1, static_cast<std::uint32_t>(sorted_.size()));
+        else position_.assign(sorted_.size() + 1, sorted_.size());
+        std::size_t next = 0;
+        build(1, next);
+    }
+
+    void build(std::size_t node, std::size_t& next) {
+        // In-order traversal of the implicit tree visits nodes in sorted order
+        if (node >= tree_.size()) return;
+        build(2 * node, next);
+        tree_[node] = upper64(sorted_[next]);
+        if (!position32_.empty()) position32_[node] = static_cast<std::uint32_t>(next);
+        else position_[node] = next;
+        next++;
+        build(2 * node + 1, next);
+    }
+
+    std::size_t lower_bound_upper64(std::uint64_t key) const noexcept {
+        const std::size_t n = sorted_.size();
+        const std::uint64_t* tree = tree_.data();
+        std::size_t node = 1;
+        while (node <= n) {
+            // The descendants 4 levels down may lie past the end: form their address as an integer,
+            // since a pointer past the array would be undefined even if only prefetched
+            prefetch(reinterpret_cast<std::uintptr_t>(tree) + node * 16 * sizeof(std::uint64_t));
+            node = 2 * node + static_cast<std::size_t>(tree[node] < key);
+        }
+        // Undo the right turns taken after the last left turn
+        node >>= count_trailing_ones(node) + 1;
+        if (node == 0) return n;
+        return position32_.empty() ? position_[node] : position32_[node];
+    }
+
+    static void prefetch(std::uintptr_t address) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+        __builtin_prefetch(reinterpret_cast<const void*>(address));
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+        _mm_prefetch(reinterpret_cast<const char*>(address), _MM_HINT_T0);
+#else
+        (void)address;
+#endif
+    }
+
+    static unsigned count_trailing_ones(std::size_t value) noexcept {
+#if __cpp_lib_bitops >= 201907L
+        return static_cast<unsigned>(std::countr_one(value));
+#else
+        unsigned count = 0;
+        while (value & 1) {
+            value >>= 1;
+            count++;
+        }
+        return count;
+#endif
+    }
+};
+
+} // namespace uuidv7
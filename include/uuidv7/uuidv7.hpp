@@ -2,8 +2,11 @@
 
 #include <array>
 #include <cassert>
+#include <charconv>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <optional>
 #include <ostream>
 #include <stdexcept>
@@ -17,6 +20,14 @@
     #define NO_CONSTEXPR_ALGO
 #endif
 
+#if __cpp_lib_is_constant_evaluated >= 201811L
+    #include <type_traits>
+#endif
+
+#if __cpp_lib_format >= 201907L
+    #include <format>
+#endif
+
 #if __cpp_lib_constexpr_string >= 201907L
     #define CONSTEXPR_STRING constexpr
 #else
@@ -25,7 +36,173 @@
 
 namespace uuidv7 {
 
-class uuidv7_generator;
+/// @cond Doxygen_suppress
+namespace detail {
+    /// Load 8 bytes as a big-endian integer (a single load + byte swap at runtime)
+    constexpr std::uint64_t load_be64(const std::uint8_t* bytes) noexcept {
+#if (__cpp_lib_is_constant_evaluated >= 201811L || __GNUC__ >= 9 || __clang_major__ >= 9) && (defined(__GNUC__) || defined(__clang__)) && defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+        if (!__builtin_is_constant_evaluated()) {
+            std::uint64_t value = 0;
+            std::memcpy(&value, bytes, sizeof(value));
+            return __builtin_bswap64(value);
+        }
+#endif
+        std::uint64_t value = 0;
+        for (int i = 0; i < 8; i++) value = (value << 8) | bytes[i];
+        return value;
+    }
+
+    /// Well-mixed 64-bit hash of 16 UUID bytes for hash tables and filters.
+    /// Counter policies increment the low bits of `rand_b`, so both big-endian words are
+    /// folded and multiplied, which carries those bits up into every higher bit.
+    constexpr std::uint64_t mix_hash_bytes(const std::uint8_t* bytes) noexcept {
+        std::uint64_t h = (load_be64(bytes) ^ load_be64(bytes + 8)) * 0x9E3779B97F4A7C15;
+        return h ^ (h >> 32);
+    }
+
+    /// Hash of 16 UUID bytes (shared by `uuidv7` and `uuidv7_view`)
+    constexpr std::size_t hash_bytes(const std::uint8_t* bytes) noexcept {
+        constexpr int Size = sizeof(std::size_t);
+        std::size_t hash = 0;
+        for (int i = 0; i < 16 / Size; i++) {
+            std::size_t value = 0;
+            for (int j = 0; j < Size; j++) {
+                value = (value << 8) | bytes[i * Size + j];
+            }
+            hash ^= value;
+        }
+        return hash;
+    }
+
+    /// Write 16 UUID bytes as 36 (or 32 without hyphens) hex digits and return the end
+    constexpr char* write_hex(const std::uint8_t* bytes, bool include_hyphens, bool upper, char* out) noexcept {
+        const char* hex_chars = upper ? "0123456789ABCDEF" : "0123456789abcdef";
+        for (int i = 0; i < 16; i++) {
+            if (include_hyphens && (i == 4 || i == 6 || i == 8 || i == 10))
+                *out++ = '-';
+
+            const std::uint8_t byte = bytes[i];
+            *out++ = hex_chars[(byte >> 4) & 0x0F];
+            *out++ = hex_chars[byte & 0x0F];
+        }
+        return out;
+    }
+
+    /// String representation of 16 UUID bytes (shared by `uuidv7` and `uuidv7_view`)
+    CONSTEXPR_STRING std::string to_string(const std::uint8_t* bytes, bool include_hyphens) {
+        std::string result(include_hyphens ? 36 : 32, '\0');
+        write_hex(bytes, include_hyphens, false, result.data());
+        return result;
+    }
+
+    /// Crockford Base32 alphabet (ascending in ASCII, so encodings sort like the UUIDs)
+    constexpr char BASE32_CHARS[] = "0123456789ABCDEFGHJKMNPQRSTVWXYZ";
+    /// URL-safe Base64 alphabet (RFC 4648 Section 5)
+    constexpr char BASE64URL_CHARS[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+    /// Character to digit value lookup table (0xFF for characters outside the alphabet)
+    constexpr std::array<std::uint8_t, 256> make_decode_table(const char* alphabet, std::size_t size, bool ignore_case) {
+        std::array<std::uint8_t, 256> table = {};
+        for (auto& value : table) value = 0xFF;
+        for (std::size_t i = 0; i < size; i++) {
+            auto c = static_cast<unsigned char>(alphabet[i]);
+            table[c] = static_cast<std::uint8_t>(i);
+            if (ignore_case && c >= 'A' && c <= 'Z') table[c + ('a' - 'A')] = static_cast<std::uint8_t>(i);
+        }
+        return table;
+    }
+    constexpr std::array<std::uint8_t, 256> make_base32_decode_table() {
+        std::array<std::uint8_t, 256> table = make_decode_table(BASE32_CHARS, 32, true);
+        // Crockford aliases for commonly confused characters
+        table['I'] = table['i'] = table['L'] = table['l'] = 1;
+        table['O'] = table['o'] = 0;
+        return table;
+    }
+    inline constexpr std::array<std::uint8_t, 256> HEX_DECODE = make_decode_table("0123456789ABCDEF", 16, true);
+    inline constexpr std::array<std::uint8_t, 256> BASE32_DECODE = make_base32_decode_table();
+    inline constexpr std::array<std::uint8_t, 256> BASE64URL_DECODE = make_decode_table(BASE64URL_CHARS, 64, false);
+
+    /// Write the low `count * bits` bits of `value` as `count` digits, most significant first
+    constexpr void encode_digits(std::uint64_t value, int bits, int count, const char* alphabet, char* out) noexcept {
+        const std::uint64_t mask = (1u << bits) - 1;
+        for (int i = 0; i < count; i++)
+            out[i] = alphabet[(value >> ((count - 1 - i) * bits)) & mask];
+    }
+
+    /// Write 16 UUID bytes as 26 Crockford Base32 digits and return the end
+    constexpr char* encode_base32(const std::uint8_t* bytes, char* out) noexcept {
+        // 130 bits of digits with the value right-aligned, split into chunks of 10, 60 and 60 bits
+        const std::uint64_t hi = load_be64(bytes), lo = load_be64(bytes + 8);
+        encode_digits(hi >> 56, 5, 2, BASE32_CHARS, out);
+        encode_digits((hi << 4) | (lo >> 60), 5, 12, BASE32_CHARS, out + 2);
+        encode_digits(lo, 5, 12, BASE32_CHARS, out + 14);
+        return out + 26;
+    }
+
+    /// Write 16 UUID bytes as 22 Base64url digits and return the end
+    constexpr char* encode_base64url(const std::uint8_t* bytes, char* out) noexcept {
+        // 132 bits of digits with the value left-aligned, split into chunks of 60, 60 and 12 bits
+        const std::uint64_t hi = load_be64(bytes), lo = load_be64(bytes + 8);
+        encode_digits(hi >> 4, 6, 10, BASE64URL_CHARS, out);
+        encode_digits((hi << 56) | (lo >> 8), 6, 10, BASE64URL_CHARS, out + 10);
+        encode_digits(lo << 4, 6, 2, BASE64URL_CHARS, out + 20);
+        return out + 22;
+    }
+
+    /// Options of a `std::format` / `fmt::format` replacement field for UUIDs
+    struct format_spec {
+        bool include_hyphens = true;
+        bool upper = false;
+        bool braces = false;
+        bool base32 = false;
+    };
+
+    /// Longest formatted UUID: braces around 36 hex digits and hyphens
+    constexpr std::size_t MAX_FORMATTED_LENGTH = 38;
+
+    /// Parse the format spec up to the closing `}` (or `end`); returns `false` if it is invalid.
+    ///
+    /// | Spec | Output |
+    /// |------|--------|
+    /// | (empty) or `x` | `01809424-3e59-7c05-9219-566f82fff672` |
+    /// | `X` | upper-case hex digits |
+    /// | `n` | no hyphens (32 hex digits) |
+    /// | `b` | enclosed in braces |
+    /// | `c` | Crockford Base32 (26 characters; not combinable) |
+    ///
+    /// `X`, `n` and `b` can be combined, e.g. `{:bX}`.
+    template <class It>
+    constexpr bool parse_format_spec(It& it, It end, format_spec& spec) {
+        for (; it != end && *it != '}'; ++it) {
+            switch (*it) {
+                case 'x': break;
+                case 'X': spec.upper = true; break;
+                case 'n': spec.include_hyphens = false; break;
+                case 'b': spec.braces = true; break;
+                case 'c': spec.base32 = true; break;
+                default: return false;
+            }
+        }
+        return !spec.base32 || (spec.include_hyphens && !spec.upper && !spec.braces);
+    }
+
+    /// Write 16 UUID bytes as described by `spec` (at most `MAX_FORMATTED_LENGTH` characters) and return the end
+    constexpr char* write_formatted(const std::uint8_t* bytes, const format_spec& spec, char* out) noexcept {
+        if (spec.base32) return encode_base32(bytes, out);
+        if (spec.braces) *out++ = '{';
+        out = write_hex(bytes, spec.include_hyphens, spec.upper, out);
+        if (spec.braces) *out++ = '}';
+        return out;
+    }
+} // namespace detail
+/// @endcond
+
+template <class Clock, class Entropy, class Lock, class CounterPolicy>
+class basic_uuidv7_generator;
+template <class CounterPolicy>
+class uuidv7_lease;
+class shared_uuidv7_generator;
+class uuidv7_view;
 
 /// @brief Error class representing an invalid format error when parsing `uuidv7`
 class UUIDV7LIB_EXPORT invalid_format_error : public std::invalid_argument {
@@ -54,16 +231,37 @@ public:
     static constexpr std::uint8_t VARIANT = 0b10;
 
     /// @brief Parse `uuidv7` from string
+    ///
+    /// Accepts the hyphenated (36 characters) and compact (32 characters) forms, optionally
+    /// enclosed in braces, and the `urn:uuid:` form. Hex digits are case-insensitive.
     /// @param str UUID Version 7 string
     /// @return `uuidv7` object
     /// @throw invalid_format_error if the string does not conform to UUID Version 7 format
     static constexpr uuidv7 parse(std::string_view const& str);
 
     /// @brief Try to parse `uuidv7` from string
-    /// @param str UUID Version 7 string
+    /// @param str UUID Version 7 string (same forms as `parse()`)
     /// @return std::optional<uuidv7> (`std::nullopt` on failure)
     static constexpr std::optional<uuidv7> try_parse(std::string_view const& str) noexcept;
 
+    /// @brief Outcome of parsing a UUID string
+    enum class ParseResult : std::uint8_t {
+        Success = 0,    ///< The string is a valid UUID Version 7
+        InvalidVersion, ///< The version digit is not `7`
+        InvalidVariant, ///< The variant bits are not `0b10`
+        InvalidFormat,  ///< The length, separators or characters are invalid
+    };
+
+    struct parse_ex_result;
+
+    /// @brief Parse `uuidv7` from string, reporting why and where parsing failed
+    ///
+    /// Accepts the same forms as `parse()`, but never throws or allocates, so rejecting
+    /// malformed input costs no more than accepting it.
+    /// @param str UUID Version 7 string
+    /// @return Parsed value, `ParseResult` and the offset of the offending character
+    static constexpr parse_ex_result parse_ex(std::string_view const& str) noexcept;
+
     /// @brief Create `uuidv7` from a 16-byte array
     /// @param bytes 16-byte array
     /// @return `uuidv7` object
@@ -76,6 +274,24 @@ public:
     /// @throw invalid_format_error if the byte array does not conform to UUID Version 7 format
     static constexpr uuidv7 from_bytes(const uint8_t* bytes);
 
+    /// @brief Create `uuidv7` from a 16-byte array pointer without validation
+    /// @param bytes Pointer to 16-byte array holding a valid UUID Version 7
+    /// @return `uuidv7` object
+    /// @note For trusted data only (e.g. written by this library); the version and variant are not checked.
+    static constexpr uuidv7 from_bytes_unchecked(const uint8_t* bytes) noexcept;
+
+    /// @brief Create `uuidv7` from its field values
+    /// @param unix_ts_ms 48-bit Unix timestamp in milliseconds
+    /// @param rand_a 12-bit `rand_a` field
+    /// @param rand_b 62-bit `rand_b` field
+    /// @return `uuidv7` object
+    /// @throw std::out_of_range if a field does not fit in its width
+    static constexpr uuidv7 from_fields(std::uint64_t unix_ts_ms, std::uint16_t rand_a, std::uint64_t rand_b) {
+        if (unix_ts_ms > 0xFFFFFFFFFFFF || rand_a > MAX_RAND_A || rand_b > MAX_RAND_B)
+            throw std::out_of_range("UUID Version 7 field is out of range");
+        return uuidv7(unix_ts_ms, rand_a, rand_b);
+    }
+
     /// @brief Get the 16-byte array representation of the `uuidv7`
     /// @return 16-byte array representing the `uuidv7`
     constexpr std::array<uint8_t, 16> get_bytes() const noexcept { return data_; }
@@ -86,6 +302,152 @@ public:
     /// @note In C++17, this function is not constexpr due to `std::string` limitations.
     CONSTEXPR_STRING std::string to_string(bool include_hyphens = true) const;
 
+    /// @brief Text forms written by `to_chars()` (all accepted by `parse()`)
+    enum class string_style : std::uint8_t {
+        hyphenated, ///< `01809424-3e59-7c05-9219-566f82fff672` (36 characters)
+        compact,    ///< `018094243e597c059219566f82fff672` (32 characters)
+        braced,     ///< `{01809424-3e59-7c05-9219-566f82fff672}` (38 characters)
+        urn,        ///< `urn:uuid:01809424-3e59-7c05-9219-566f82fff672` (45 characters)
+    };
+
+    /// @brief Write the string representation into a buffer (no allocation, no terminator)
+    /// @param first Beginning of the buffer
+    /// @param last End of the buffer
+    /// @param style Text form (default: `string_style::hyphenated`)
+    /// @param uppercase Whether to write upper-case hex digits (default: `false`)
+    /// @return Pointer past the written characters and `std::errc()`, or `{ last, std::errc::value_too_large }` if the buffer is too small
+    constexpr std::to_chars_result to_chars(char* first, char* last, string_style style = string_style::hyphenated,
+                                            bool uppercase = false) const noexcept;
+
+    /// @brief Length of the Crockford Base32 representation
+    static constexpr std::size_t BASE32_LENGTH = 26;
+    /// @brief Length of the URL-safe Base64 representation
+    static constexpr std::size_t BASE64URL_LENGTH = 22;
+
+    /// @brief Convert `uuidv7` to its Crockford Base32 representation (26 characters, as in ULID)
+    ///
+    /// The encodings sort lexicographically in the same order as the UUIDs.
+    /// @return Upper-case Crockford Base32 string
+    /// @note In C++17, this function is not constexpr due to `std::string` limitations.
+    CONSTEXPR_STRING std::string to_base32() const;
+
+    /// @brief Write the Crockford Base32 representation into a buffer (no allocation, no terminator)
+    /// @param first Beginning of the buffer
+    /// @param last End of the buffer
+    /// @return `{ first + 26, std::errc() }`, or `{ last, std::errc::value_too_large }` if the buffer is too small
+    constexpr std::to_chars_result to_chars_base32(char* first, char* last) const noexcept;
+
+    /// @brief Parse `uuidv7` from its Crockford Base32 representation
+    ///
+    /// Decoding is case-insensitive and accepts the Crockford aliases `I`/`L` (1) and `O` (0).
+    /// @param str 26-character Crockford Base32 string
+    /// @return `uuidv7` object
+    /// @throw invalid_format_error if the string is not a Base32-encoded UUID Version 7
+    static constexpr uuidv7 parse_base32(std::string_view const& str);
+
+    /// @brief Try to parse `uuidv7` from its Crockford Base32 representation
+    /// @param str 26-character Crockford Base32 string
+    /// @return std::optional<uuidv7> (`std::nullopt` on failure)
+    static constexpr std::optional<uuidv7> try_parse_base32(std::string_view const& str) noexcept;
+
+    /// @brief Create `uuidv7` from a binary ULID
+    ///
+    /// The 48-bit timestamp and the bit positions of the 80 random bits are kept as they are,
+    /// except for the 6 bits the UUID layout reserves: the version nibble (bits 48-51) and the
+    /// variant bits (bits 64-65) are overwritten, so those 6 random bits of the ULID are lost.
+    /// The mapping is not order-preserving: ULIDs that differ only in the lost bits map to the same
+    /// UUID, and an increment of a monotonic ULID generator that carries into those bits (e.g. low
+    /// word `0x3FFF...FF` to `0x4000...00`) maps to a smaller UUID.
+    /// @param ulid 16-byte ULID (big-endian binary form)
+    /// @return `uuidv7` object
+    static constexpr uuidv7 from_ulid(const std::array<uint8_t, 16>& ulid) noexcept;
+
+    /// @brief Create `uuidv7` from a pointer to a binary ULID
+    /// @param ulid Pointer to a 16-byte ULID (big-endian binary form, must not be null)
+    /// @return `uuidv7` object
+    /// @sa from_ulid(const std::array<uint8_t, 16>&) for the bits that are lost
+    static constexpr uuidv7 from_ulid(const uint8_t* ulid) noexcept;
+
+    /// @brief Parse `uuidv7` from a ULID string
+    /// @param str 26-character ULID string (Crockford Base32, case-insensitive)
+    /// @return `uuidv7` object
+    /// @throw invalid_format_error if the string is not a valid ULID
+    /// @sa from_ulid(const std::array<uint8_t, 16>&) for the bits that are lost
+    static constexpr uuidv7 parse_ulid(std::string_view const& str);
+
+    /// @brief Try to parse `uuidv7` from a ULID string
+    /// @param str 26-character ULID string (Crockford Base32, case-insensitive)
+    /// @return std::optional<uuidv7> (`std::nullopt` on failure)
+    static constexpr std::optional<uuidv7> try_parse_ulid(std::string_view const& str) noexcept;
+
+    /// @brief Convert `uuidv7` to a binary ULID (lossless)
+    ///
+    /// Every UUID Version 7 is a valid ULID with the same timestamp; the version and variant
+    /// bits become part of the ULID randomness. The ULID string is `to_base32()`.
+    /// @return 16-byte ULID (big-endian binary form)
+    constexpr std::array<uint8_t, 16> to_ulid() const noexcept { return data_; }
+
+    /// @brief Convert `uuidv7` to its unpadded URL-safe Base64 representation (22 characters)
+    /// @return Base64url string (RFC 4648 Section 5, without padding)
+    /// @note The encodings do not sort in UUID order. In C++17, this function is not constexpr due to `std::string` limitations.
+    CONSTEXPR_STRING std::string to_base64url() const;
+
+    /// @brief Write the URL-safe Base64 representation into a buffer (no allocation, no terminator)
+    /// @param first Beginning of the buffer
+    /// @param last End of the buffer
+    /// @return `{ first + 22, std::errc() }`, or `{ last, std::errc::value_too_large }` if the buffer is too small
+    constexpr std::to_chars_result to_chars_base64url(char* first, char* last) const noexcept;
+
+    /// @brief Parse `uuidv7` from its unpadded URL-safe Base64 representation
+    /// @param str 22-character Base64url string
+    /// @return `uuidv7` object
+    /// @throw invalid_format_error if the string is not a Base64url-encoded UUID Version 7
+    static constexpr uuidv7 parse_base64url(std::string_view const& str);
+
+    /// @brief Try to parse `uuidv7` from its unpadded URL-safe Base64 representation
+    /// @param str 22-character Base64url string
+    /// @return std::optional<uuidv7> (`std::nullopt` on failure)
+    static constexpr std::optional<uuidv7> try_parse_base64url(std::string_view const& str) noexcept;
+
+    /// @brief Get the 48-bit Unix timestamp in milliseconds (`unix_ts_ms` field)
+    /// @return Unix timestamp in milliseconds
+    constexpr std::uint64_t unix_ts_ms() const noexcept { return detail::load_be64(data_.data()) >> 16; }
+
+    /// @brief Get the 12-bit `rand_a` field
+    /// @return Value of `rand_a`
+    constexpr std::uint16_t rand_a() const noexcept {
+        return static_cast<std::uint16_t>(detail::load_be64(data_.data()) & MAX_RAND_A);
+    }
+
+    /// @brief Get the 62-bit `rand_b` field
+    /// @return Value of `rand_b`
+    constexpr std::uint64_t rand_b() const noexcept { return detail::load_be64(data_.data() + 8) & MAX_RAND_B; }
+
+    /// @brief Get the creation time of the `uuidv7`
+    /// @return Time point of `unix_ts_ms`
+    constexpr std::chrono::system_clock::time_point time_point() const noexcept {
+        return std::chrono::system_clock::time_point(
+            std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::milliseconds(unix_ts_ms())));
+    }
+
+    /// @brief Get the smallest `uuidv7` with the timestamp of the given time point
+    /// @param tp Time point (truncated to milliseconds)
+    /// @return `uuidv7` object with all `rand_a` and `rand_b` bits cleared
+    /// @throw std::out_of_range if the time point is before the Unix epoch or does not fit in 48 bits
+    template <class Duration>
+    static constexpr uuidv7 min_for_time(std::chrono::time_point<std::chrono::system_clock, Duration> tp) {
+        return uuidv7(to_unix_ts_ms(tp), 0, 0);
+    }
+
+    /// @brief Get the largest `uuidv7` with the timestamp of the given time point
+    /// @param tp Time point (truncated to milliseconds)
+    /// @return `uuidv7` object with all `rand_a` and `rand_b` bits set
+    /// @throw std::out_of_range if the time point is before the Unix epoch or does not fit in 48 bits
+    template <class Duration>
+    static constexpr uuidv7 max_for_time(std::chrono::time_point<std::chrono::system_clock, Duration> tp) {
+        return uuidv7(to_unix_ts_ms(tp), MAX_RAND_A, MAX_RAND_B);
+    }
+
     /// @brief Get hash value for `uuidv7`
     /// @return Hash value
     constexpr size_t get_hash() const noexcept;
@@ -96,19 +458,47 @@ private:
     constexpr uuidv7(std::array<uint8_t, 16> bytes) : data_(bytes) { }
     constexpr uuidv7(std::uint64_t unix_ts_ms, std::uint16_t rand_a, std::uint64_t rand_b);
 
-    enum class ParseResult : std::uint8_t {
-        Success = 0,
-        InvalidVersion,
-        InvalidVariant,
-        InvalidFormat,
-    };
-    static constexpr ParseResult parse_inner(std::string_view const& str, std::array<std::uint8_t, 16>& result);
+    static constexpr ParseResult parse_inner(std::string_view const& str, std::array<std::uint8_t, 16>& result,
+                                             std::size_t& error_offset);
+    static constexpr ParseResult parse_base32_inner(std::string_view const& str, std::array<std::uint8_t, 16>& result);
+    static constexpr ParseResult parse_base64url_inner(std::string_view const& str, std::array<std::uint8_t, 16>& result);
+    static constexpr bool decode_base32(std::string_view const& str, std::uint64_t& hi, std::uint64_t& lo);
+    static constexpr ParseResult check_fields(std::uint64_t hi, std::uint64_t lo, std::array<std::uint8_t, 16>& result);
+    static constexpr uuidv7 parse_result(ParseResult parse_result, std::array<std::uint8_t, 16> const& bytes);
+
+    template <class Duration>
+    static constexpr std::uint64_t to_unix_ts_ms(std::chrono::time_point<std::chrono::system_clock, Duration> tp) {
+        auto millis = std::chrono::floor<std::chrono::milliseconds>(tp.time_since_epoch()).count();
+        if (millis < 0 || static_cast<std::uint64_t>(millis) > 0xFFFFFFFFFFFF)
+            throw std::out_of_range("Time point is out of the UUID Version 7 timestamp range");
+        return static_cast<std::uint64_t>(millis);
+    }
 
     friend bool operator==(const uuidv7& lhs, const uuidv7& rhs);
     friend bool operator<(const uuidv7& lhs, const uuidv7& rhs);
+    friend std::ostream& operator<<(std::ostream& os, const uuidv7& uuid);
 
     /// @brief Generator class
-    friend class uuidv7_generator;
+    template <class Clock, class Entropy, class Lock, class CounterPolicy>
+    friend class basic_uuidv7_generator;
+    template <class CounterPolicy>
+    friend class uuidv7_lease;
+    friend class shared_uuidv7_generator;
+    friend class uuidv7_view;
+};
+
+/// @brief Result of `uuidv7::parse_ex()`
+struct uuidv7::parse_ex_result {
+    /// @brief Parsed value (meaningful only if `result` is `ParseResult::Success`)
+    uuidv7 value;
+    /// @brief Outcome of parsing
+    ParseResult result;
+    /// @brief Offset of the first offending character (the input length if no accepted form has that length; 0 on success)
+    std::size_t error_offset;
+
+    /// @brief Check whether parsing succeeded
+    /// @return `true` if `result` is `ParseResult::Success`
+    constexpr explicit operator bool() const noexcept { return result == ParseResult::Success; }
 };
 
 
@@ -122,7 +512,11 @@ inline bool operator!=(const uuidv7& lhs, const uuidv7& rhs) { return !(lhs == r
 
 /// @brief Less-than operator for `uuidv7`
 inline bool operator<(const uuidv7& lhs, const uuidv7& rhs) {
-    return lhs.data_ < rhs.data_;
+    // Big-endian word comparison is equivalent to the lexicographic byte comparison
+    const std::uint64_t lhs_upper = detail::load_be64(lhs.data_.data());
+    const std::uint64_t rhs_upper = detail::load_be64(rhs.data_.data());
+    if (lhs_upper != rhs_upper) return lhs_upper < rhs_upper;
+    return detail::load_be64(lhs.data_.data() + 8) < detail::load_be64(rhs.data_.data() + 8);
 }
 /// @brief Greater-than operator for `uuidv7`
 inline bool operator>(const uuidv7& lhs, const uuidv7& rhs) { return rhs < lhs; }
@@ -133,7 +527,9 @@ inline bool operator>=(const uuidv7& lhs, const uuidv7& rhs) { return !(lhs < rh
 
 /// @brief Output stream operator for `uuidv7`
 inline std::ostream& operator<<(std::ostream& os, const uuidv7& uuid) {
-    return os << uuid.to_string();
+    char buffer[36];
+    detail::write_hex(uuid.data_.data(), true, false, buffer);
+    return os << std::string_view(buffer, sizeof(buffer)); // Formatted insert honors width and fill
 }
 
 
@@ -167,53 +563,88 @@ constexpr uuidv7::uuidv7(std::uint64_t unix_ts_ms, std::uint16_t rand_a, std::ui
     data_[15] = rand_b & 0xFF;
 }
 
-constexpr uuidv7::ParseResult uuidv7::parse_inner(std::string_view const& str, std::array<std::uint8_t, 16>& result)
+constexpr uuidv7::ParseResult uuidv7::parse_inner(std::string_view const& str, std::array<std::uint8_t, 16>& result,
+                                                  std::size_t& error_offset)
 {
+    // Strip "{...}" or "urn:uuid:" in place; the hex digits are then decoded in a single pass
+    std::string_view body = str;
+    std::size_t prefix = 0;
+    if ((str.length() == 38 || str.length() == 34) && str.front() == '{' && str.back() == '}') {
+        body = str.substr(1, str.length() - 2);
+        prefix = 1;
+    } else if (str.length() == 45) {
+        constexpr char URN_PREFIX[] = "urn:uuid:";
+        for (std::size_t i = 0; i < 9; i++) {
+            char c = str[i];
+            if (c >= 'A' && c <= 'Z') c = static_cast<char>(c + ('a' - 'A'));
+            if (c != URN_PREFIX[i]) {
+                error_offset = i;
+                return ParseResult::InvalidFormat;
+            }
+        }
+        body = str.substr(9);
+        prefix = 9;
+    }
+
     bool include_hyphens = false;
-    int version_index = -1, variant_index = -1;
-    if (str.length() == 36) {
-        if (str[8] != '-' || str[13] != '-' || str[18] != '-' || str[23] != '-')
-            return ParseResult::InvalidFormat;
+    std::size_t version_index = 0, variant_index = 0;
+    if (body.length() == 36) {
+        for (std::size_t hyphen : { 8, 13, 18, 23 }) {
+            if (body[hyphen] != '-') {
+                error_offset = prefix + hyphen;
+                return ParseResult::InvalidFormat;
+            }
+        }
         include_hyphens = true;
         version_index = 14;
         variant_index = 19;
-    } else if (str.length() == 32) {
+    } else if (body.length() == 32) {
         version_index = 12;
         variant_index = 16;
-    } else return ParseResult::InvalidFormat;
+    } else {
+        error_offset = str.length();
+        return ParseResult::InvalidFormat;
+    }
 
-    if (str[version_index] != '7')
+    if (body[version_index] != '7') {
+        error_offset = prefix + version_index;
         return ParseResult::InvalidVersion;
+    }
 
-    auto hex_to_int = [](char c) -> std::uint8_t {
-        if (c >= '0' && c <= '9') return static_cast<std::uint8_t>(c - '0');
-        if (c >= 'a' && c <= 'f') return static_cast<std::uint8_t>(c - 'a' + 10);
-        if (c >= 'A' && c <= 'F') return static_cast<std::uint8_t>(c - 'A' + 10);
-        return 0xFF;
-    };
-
-    auto var_char = hex_to_int(str[variant_index]);
-    if (var_char == 0xFF) return ParseResult::InvalidFormat;
-    if (((var_char & 0b1100) >> 2) != VARIANT)
-        return ParseResult::InvalidVariant;
+    auto var_char = detail::HEX_DECODE[static_cast<unsigned char>(body[variant_index])];
+    if (var_char == 0xFF || ((var_char & 0b1100) >> 2) != VARIANT) {
+        error_offset = prefix + variant_index;
+        return var_char == 0xFF ? ParseResult::InvalidFormat : ParseResult::InvalidVariant;
+    }
 
-    int c = 0;
+    // Invalid characters map to 0xFF: accumulate them and check once at the end
+    std::uint8_t invalid = 0;
+    std::size_t c = 0;
     for (int i = 0; i < 16; i++) {
         if (include_hyphens && (c == 8 || c == 13 || c == 18 || c == 23)) c++;
 
-        std::uint8_t h1 = hex_to_int(str[c]), h2 = hex_to_int(str[c + 1]);
-        if (h1 == 0xFF || h2 == 0xFF) return ParseResult::InvalidFormat;
+        std::uint8_t h1 = detail::HEX_DECODE[static_cast<unsigned char>(body[c])];
+        std::uint8_t h2 = detail::HEX_DECODE[static_cast<unsigned char>(body[c + 1])];
+        invalid |= h1 | h2;
 
-        result[i] = h1 << 4 | h2;
+        result[i] = static_cast<std::uint8_t>(h1 << 4 | (h2 & 0x0F));
         c += 2;
     }
+    if (invalid & 0xF0) {
+        // Rare path: locate the first offending character
+        for (c = 0; c < body.length(); c++) {
+            if (include_hyphens && (c == 8 || c == 13 || c == 18 || c == 23)) continue;
+            if (detail::HEX_DECODE[static_cast<unsigned char>(body[c])] == 0xFF) break;
+        }
+        error_offset = prefix + c;
+        return ParseResult::InvalidFormat;
+    }
     return ParseResult::Success;
 }
-constexpr uuidv7 uuidv7::parse(std::string_view const& str) {
-    uuidv7 result {0, 0, 0};
-    switch (parse_inner(str, result.data_)) {
+constexpr uuidv7 uuidv7::parse_result(ParseResult parse_result, std::array<std::uint8_t, 16> const& bytes) {
+    switch (parse_result) {
         case ParseResult::Success:
-            return result;
+            return uuidv7(bytes);
         case ParseResult::InvalidVersion:
             throw invalid_format_error("Invalid UUID Version 7 version");
         case ParseResult::InvalidVariant:
@@ -224,12 +655,124 @@ constexpr uuidv7 uuidv7::parse(std::string_view const& str) {
             throw invalid_format_error("Unknown UUID Version 7 parse error");
     }
 }
+constexpr uuidv7 uuidv7::parse(std::string_view const& str) {
+    std::array<std::uint8_t, 16> bytes = {};
+    std::size_t error_offset = 0;
+    ParseResult result = parse_inner(str, bytes, error_offset);
+    return parse_result(result, bytes);
+}
 constexpr std::optional<uuidv7> uuidv7::try_parse(std::string_view const& str) noexcept {
     uuidv7 result {0, 0, 0};
-    if (parse_inner(str, result.data_) == ParseResult::Success)
+    std::size_t error_offset = 0;
+    if (parse_inner(str, result.data_, error_offset) == ParseResult::Success)
         return result;
     return std::nullopt;
 }
+constexpr uuidv7::parse_ex_result uuidv7::parse_ex(std::string_view const& str) noexcept {
+    parse_ex_result ex { uuidv7 {0, 0, 0}, ParseResult::Success, 0 };
+    ex.result = parse_inner(str, ex.value.data_, ex.error_offset);
+    return ex;
+}
+
+constexpr uuidv7::ParseResult uuidv7::check_fields(std::uint64_t hi, std::uint64_t lo, std::array<std::uint8_t, 16>& result) {
+    if (((hi >> 12) & 0b1111) != VERSION)
+        return ParseResult::InvalidVersion;
+    if ((lo >> 62) != VARIANT)
+        return ParseResult::InvalidVariant;
+    for (int i = 0; i < 8; i++) {
+        result[i] = static_cast<std::uint8_t>(hi >> (56 - i * 8));
+        result[8 + i] = static_cast<std::uint8_t>(lo >> (56 - i * 8));
+    }
+    return ParseResult::Success;
+}
+
+constexpr bool uuidv7::decode_base32(std::string_view const& str, std::uint64_t& hi, std::uint64_t& lo) {
+    if (str.length() != BASE32_LENGTH) return false;
+    // 26 digits of 5 bits hold 130 bits: the first digit carries only the top 3 bits
+    std::uint8_t invalid = detail::BASE32_DECODE[static_cast<unsigned char>(str[0])] & 0xF8;
+    hi = 0;
+    lo = 0;
+    for (char c : str) {
+        std::uint8_t digit = detail::BASE32_DECODE[static_cast<unsigned char>(c)];
+        invalid |= digit & 0xE0;
+        hi = (hi << 5) | (lo >> 59);
+        lo = (lo << 5) | (digit & 0x1F);
+    }
+    return !invalid;
+}
+
+constexpr uuidv7::ParseResult uuidv7::parse_base32_inner(std::string_view const& str, std::array<std::uint8_t, 16>& result) {
+    std::uint64_t hi = 0, lo = 0;
+    if (!decode_base32(str, hi, lo)) return ParseResult::InvalidFormat;
+    return check_fields(hi, lo, result);
+}
+
+constexpr uuidv7::ParseResult uuidv7::parse_base64url_inner(std::string_view const& str, std::array<std::uint8_t, 16>& result) {
+    if (str.length() != BASE64URL_LENGTH) return ParseResult::InvalidFormat;
+    // 22 digits of 6 bits hold 132 bits: the last digit carries only 2 bits, and the rest must be zero
+    std::uint8_t last = detail::BASE64URL_DECODE[static_cast<unsigned char>(str[BASE64URL_LENGTH - 1])];
+    std::uint8_t invalid = (last & 0xC0) | (last & 0x0F);
+    std::uint64_t hi = 0, lo = 0;
+    for (std::size_t i = 0; i + 1 < BASE64URL_LENGTH; i++) {
+        std::uint8_t digit = detail::BASE64URL_DECODE[static_cast<unsigned char>(str[i])];
+        invalid |= digit & 0xC0;
+        hi = (hi << 6) | (lo >> 58);
+        lo = (lo << 6) | (digit & 0x3F);
+    }
+    hi = (hi << 2) | (lo >> 62);
+    lo = (lo << 2) | ((last >> 4) & 0b11);
+    if (invalid) return ParseResult::InvalidFormat;
+    return check_fields(hi, lo, result);
+}
+
+constexpr uuidv7 uuidv7::parse_base32(std::string_view const& str) {
+    std::array<std::uint8_t, 16> bytes = {};
+    ParseResult result = parse_base32_inner(str, bytes);
+    return parse_result(result, bytes);
+}
+constexpr std::optional<uuidv7> uuidv7::try_parse_base32(std::string_view const& str) noexcept {
+    std::array<std::uint8_t, 16> bytes = {};
+    if (parse_base32_inner(str, bytes) == ParseResult::Success)
+        return uuidv7(bytes);
+    return std::nullopt;
+}
+
+constexpr uuidv7 uuidv7::from_ulid(const std::array<uint8_t, 16>& ulid) noexcept {
+    std::array<uint8_t, 16> bytes = ulid;
+    bytes[6] = static_cast<uint8_t>((bytes[6] & 0x0F) | (VERSION << 4));
+    bytes[8] = static_cast<uint8_t>((bytes[8] & 0x3F) | (VARIANT << 6));
+    return uuidv7(bytes);
+}
+
+constexpr uuidv7 uuidv7::from_ulid(const uint8_t* ulid) noexcept {
+    std::array<uint8_t, 16> bytes = {};
+    for (int i = 0; i < 16; i++) bytes[i] = ulid[i];
+    return from_ulid(bytes);
+}
+
+constexpr uuidv7 uuidv7::parse_ulid(std::string_view const& str) {
+    std::uint64_t hi = 0, lo = 0;
+    if (!decode_base32(str, hi, lo))
+        throw invalid_format_error("Invalid ULID string format");
+    return uuidv7(hi >> 16, static_cast<std::uint16_t>(hi & MAX_RAND_A), lo & MAX_RAND_B);
+}
+constexpr std::optional<uuidv7> uuidv7::try_parse_ulid(std::string_view const& str) noexcept {
+    std::uint64_t hi = 0, lo = 0;
+    if (!decode_base32(str, hi, lo)) return std::nullopt;
+    return uuidv7(hi >> 16, static_cast<std::uint16_t>(hi & MAX_RAND_A), lo & MAX_RAND_B);
+}
+
+constexpr uuidv7 uuidv7::parse_base64url(std::string_view const& str) {
+    std::array<std::uint8_t, 16> bytes = {};
+    ParseResult result = parse_base64url_inner(str, bytes);
+    return parse_result(result, bytes);
+}
+constexpr std::optional<uuidv7> uuidv7::try_parse_base64url(std::string_view const& str) noexcept {
+    std::array<std::uint8_t, 16> bytes = {};
+    if (parse_base64url_inner(str, bytes) == ParseResult::Success)
+        return uuidv7(bytes);
+    return std::nullopt;
+}
 
 constexpr uuidv7 uuidv7::from_bytes(std::array<uint8_t, 16> const& bytes) {
     if (((bytes[6] >> 4) & 0b1111) != VERSION)
@@ -253,35 +796,64 @@ constexpr uuidv7 uuidv7::from_bytes(const uint8_t* bytes) {
     return from_bytes(ary);
 }
 
-CONSTEXPR_STRING std::string uuidv7::to_string(bool include_hyphens) const {
-    constexpr char HEX_CHARS[] = "0123456789abcdef";
-    std::string result(include_hyphens ? 36 : 32, '\0');
-    std::array<uint8_t, 16> bytes = get_bytes();
+constexpr uuidv7 uuidv7::from_bytes_unchecked(const uint8_t* bytes) noexcept {
+    assert(bytes && ((bytes[6] >> 4) & 0b1111) == VERSION && ((bytes[8] >> 6) & 0b11) == VARIANT);
+    std::array<uint8_t, 16> ary = {};
 
-    int c = 0;
-    for (int i = 0; i < 16; i++) {
-        if (include_hyphens && (i == 4 || i == 6 || i == 8 || i == 10))
-            result[c++] = '-';
+#ifdef NO_CONSTEXPR_ALGO
+    for (int i = 0; i < 16; i++) { ary[i] = bytes[i]; }
+#else
+    std::ranges::copy(bytes, bytes + 16, ary.begin());
+#endif
 
-        const uint8_t byte = bytes[i];
-        result[c] = HEX_CHARS[(byte >> 4) & 0x0F];
-        result[c + 1] = HEX_CHARS[byte & 0x0F];
-        c += 2;
+    return uuidv7(ary);
+}
+
+CONSTEXPR_STRING std::string uuidv7::to_string(bool include_hyphens) const {
+    return detail::to_string(data_.data(), include_hyphens);
+}
+
+constexpr std::to_chars_result uuidv7::to_chars(char* first, char* last, string_style style, bool uppercase) const noexcept {
+    const std::ptrdiff_t length = style == string_style::compact ? 32
+                                : style == string_style::braced ? 38
+                                : style == string_style::urn ? 45 : 36;
+    if (last - first < length) return { last, std::errc::value_too_large };
+
+    const bool include_hyphens = style != string_style::compact;
+    if (style == string_style::braced) *first++ = '{';
+    if (style == string_style::urn) {
+        constexpr char URN_PREFIX[] = "urn:uuid:";
+        for (int i = 0; i < 9; i++) *first++ = URN_PREFIX[i];
     }
+    first = detail::write_hex(data_.data(), include_hyphens, uppercase, first);
+    if (style == string_style::braced) *first++ = '}';
+    return { first, std::errc() };
+}
+
+constexpr std::to_chars_result uuidv7::to_chars_base32(char* first, char* last) const noexcept {
+    if (last - first < static_cast<std::ptrdiff_t>(BASE32_LENGTH)) return { last, std::errc::value_too_large };
+    return { detail::encode_base32(data_.data(), first), std::errc() };
+}
+
+CONSTEXPR_STRING std::string uuidv7::to_base32() const {
+    std::string result(BASE32_LENGTH, '\0');
+    to_chars_base32(result.data(), result.data() + result.size());
+    return result;
+}
+
+constexpr std::to_chars_result uuidv7::to_chars_base64url(char* first, char* last) const noexcept {
+    if (last - first < static_cast<std::ptrdiff_t>(BASE64URL_LENGTH)) return { last, std::errc::value_too_large };
+    return { detail::encode_base64url(data_.data(), first), std::errc() };
+}
+
+CONSTEXPR_STRING std::string uuidv7::to_base64url() const {
+    std::string result(BASE64URL_LENGTH, '\0');
+    to_chars_base64url(result.data(), result.data() + result.size());
     return result;
 }
 
 constexpr size_t uuidv7::get_hash() const noexcept {
-    constexpr int Size = sizeof(size_t);
-    size_t hash = 0;
-    for (int i = 0; i < 16 / Size; i++) {
-        size_t value = 0;
-        for (int j = 0; j < Size; j++) {
-            value = (value << 8) | data_[i * Size + j];
-        }
-        hash ^= value;
-    }
-    return hash;
+    return detail::hash_bytes(data_.data());
 }
 /// @endcond
 
@@ -300,3 +872,39 @@ namespace std {
     };
 } // namespace std
 /// @endcond
+
+#if __cpp_lib_format >= 201907L
+namespace std {
+    /// @brief `std::format` support for `uuidv7`
+    ///
+    /// Writes directly to the output iterator without allocating. Format spec:
+    /// `{}` or `{:x}` (hyphenated lower-case hex), `{:X}` (upper-case hex), `{:n}` (no hyphens),
+    /// `{:b}` (in braces) and `{:c}` (Crockford Base32). `X`, `n` and `b` can be combined, e.g. `{:bX}`.
+    template <>
+    struct formatter<uuidv7::uuidv7> {
+        /// @cond Doxygen_suppress
+        constexpr auto parse(std::format_parse_context& ctx) {
+            auto it = ctx.begin();
+            if (!uuidv7::detail::parse_format_spec(it, ctx.end(), spec_))
+                throw std::format_error("Invalid format spec for uuidv7");
+            return it;
+        }
+
+        template <class FormatContext>
+        auto format(const uuidv7::uuidv7& uuid, FormatContext& ctx) const {
+            return format_bytes(uuid.get_bytes().data(), ctx);
+        }
+
+    protected:
+        uuidv7::detail::format_spec spec_;
+
+        template <class FormatContext>
+        auto format_bytes(const std::uint8_t* bytes, FormatContext& ctx) const {
+            char buffer[uuidv7::detail::MAX_FORMATTED_LENGTH];
+            char* end = uuidv7::detail::write_formatted(bytes, spec_, buffer);
+            return std::copy(buffer, end, ctx.out());
+        }
+        /// @endcond
+    };
+} // namespace std
+#endif
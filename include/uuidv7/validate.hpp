@@ -0,0 +1,104 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include "uuidv7.hpp"
+#include "detail/bits.hpp"
+
+#if defined(__AVX512BW__) || defined(__AVX2__)
+    #include <immintrin.h>
+#endif
+
+namespace uuidv7 {
+
+/// @cond Doxygen_suppress
+namespace detail {
+    /// Number of UUIDs checked per bitmap word
+    constexpr std::size_t VALIDATE_CHUNK = 64;
+
+    /// Bitmask of the UUIDs in `data[0, count)` (16 bytes each, `count <= 64`) whose
+    /// version nibble (byte 6) or variant bits (byte 8) are wrong.
+    /// A UUID occupies one 16-byte lane, so the check is an AND and a compare on each
+    /// lane, restricted to bytes 6 and 8, and 4 UUIDs (2 with AVX2) are folded into the mask per iteration.
+    inline std::uint64_t invalid_mask(const std::uint8_t* data, std::size_t count) noexcept {
+        std::uint64_t mask = 0;
+        std::size_t i = 0;
+#if defined(__AVX512BW__)
+        const __m512i field = _mm512_broadcast_i32x4(_mm_setr_epi8(0, 0, 0, 0, 0, 0, '\xF0', 0, '\xC0', 0, 0, 0, 0, 0, 0, 0));
+        const __m512i expected = _mm512_broadcast_i32x4(_mm_setr_epi8(0, 0, 0, 0, 0, 0, 0x70, 0, '\x80', 0, 0, 0, 0, 0, 0, 0));
+        for (; i + 4 <= count; i += 4) {
+            __m512i v = _mm512_loadu_si512(data + i * 16);
+            // Bits 6 and 8 of each 16-bit group are set when the fields are wrong
+            std::uint64_t wrong = _mm512_mask_cmpneq_epi8_mask(0x0140014001400140, _mm512_and_si512(v, field), expected);
+            std::uint64_t lanes = ((wrong >> 6) | (wrong >> 8)) & 0x0001000100010001;
+            mask |= ((lanes | (lanes >> 15) | (lanes >> 30) | (lanes >> 45)) & 0xF) << i;
+        }
+#elif defined(__AVX2__)
+        const __m256i field = _mm256_setr_epi8(0, 0, 0, 0, 0, 0, '\xF0', 0, '\xC0', 0, 0, 0, 0, 0, 0, 0,
+                                               0, 0, 0, 0, 0, 0, '\xF0', 0, '\xC0', 0, 0, 0, 0, 0, 0, 0);
+        const __m256i expected = _mm256_setr_epi8(0, 0, 0, 0, 0, 0, 0x70, 0, '\x80', 0, 0, 0, 0, 0, 0, 0,
+                                                  0, 0, 0, 0, 0, 0, 0x70, 0, '\x80', 0, 0, 0, 0, 0, 0, 0);
+        for (; i + 2 <= count; i += 2) {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i * 16));
+            // Bits 6 and 8 of each 16-bit group are set when the fields are wrong
+            std::uint32_t wrong = ~static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_and_si256(v, field), expected)));
+            std::uint32_t lanes = ((wrong >> 6) | (wrong >> 8)) & 0x00010001;
+            mask |= static_cast<std::uint64_t>((lanes | (lanes >> 15)) & 0x3) << i;
+        }
+#elif defined(UUIDV7LIB_SSE2)
+        const __m128i field = _mm_setr_epi8(0, 0, 0, 0, 0, 0, '\xF0', 0, '\xC0', 0, 0, 0, 0, 0, 0, 0);
+        const __m128i expected = _mm_setr_epi8(0, 0, 0, 0, 0, 0, 0x70, 0, '\x80', 0, 0, 0, 0, 0, 0, 0);
+        auto matches = [&](std::size_t k) -> std::uint64_t {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + k * 16));
+            return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(v, field), expected)));
+        };
+        for (; i + 4 <= count; i += 4) {
+            // Bits 6 and 8 of each 16-bit group are set when the fields are wrong
+            std::uint64_t wrong = ~(matches(i) | matches(i + 1) << 16 | matches(i + 2) << 32 | matches(i + 3) << 48);
+            std::uint64_t lanes = ((wrong >> 6) | (wrong >> 8)) & 0x0001000100010001;
+            mask |= ((lanes | (lanes >> 15) | (lanes >> 30) | (lanes >> 45)) & 0xF) << i;
+        }
+#endif
+        for (; i < count; i++) {
+            const std::uint8_t* p = data + i * 16;
+            bool wrong = ((p[6] >> 4) & 0b1111) != uuidv7::VERSION || ((p[8] >> 6) & 0b11) != uuidv7::VARIANT;
+            mask |= static_cast<std::uint64_t>(wrong) << i;
+        }
+        return mask;
+    }
+} // namespace detail
+/// @endcond
+
+/// @brief Find the first invalid UUID in a buffer of binary UUIDs
+///
+/// Checks the version nibble (byte 6) and variant bits (byte 8) of each 16-byte UUID,
+/// as `uuidv7::from_bytes()` does, but without exceptions and several UUIDs at a time
+/// (SSE2, AVX2 or AVX-512BW, whichever the compiler targets).
+/// @param data Pointer to `n` consecutive 16-byte UUIDs
+/// @param n Number of UUIDs
+/// @return Index of the first invalid UUID, or `n` if all are valid
+inline std::size_t validate_many(const std::uint8_t* data, std::size_t n) noexcept {
+    for (std::size_t i = 0; i < n; i += detail::VALIDATE_CHUNK) {
+        std::uint64_t mask = detail::invalid_mask(data + i * 16, std::min(detail::VALIDATE_CHUNK, n - i));
+        if (mask) return i + detail::count_trailing_zeros(mask);
+    }
+    return n;
+}
+
+/// @brief Validate every UUID in a buffer of binary UUIDs and mark the invalid ones
+/// @param data Pointer to `n` consecutive 16-byte UUIDs
+/// @param n Number of UUIDs
+/// @param bitmap Output bitmap of `(n + 63) / 64` words; bit `i % 64` of word `i / 64` is set if UUID `i` is invalid
+/// @return Number of invalid UUIDs
+inline std::size_t validate_many(const std::uint8_t* data, std::size_t n, std::uint64_t* bitmap) noexcept {
+    std::size_t invalid = 0;
+    for (std::size_t i = 0; i < n; i += detail::VALIDATE_CHUNK) {
+        std::uint64_t mask = detail::invalid_mask(data + i * 16, std::min(detail::VALIDATE_CHUNK, n - i));
+        bitmap[i / detail::VALIDATE_CHUNK] = mask;
+        invalid += detail::popcount(mask);
+    }
+    return invalid;
+}
+
+} // namespace uuidv7
@@ -0,0 +1,152 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include "uuidv7.hpp"
+
+namespace uuidv7 {
+
+/// @brief Non-owning view of a UUID Version 7 stored as 16 bytes elsewhere
+///
+/// The view aliases the bytes in place (e.g. inside a memory-mapped file) and offers
+/// the accessors, comparison, hashing and formatting of `uuidv7` without copying them.
+/// Comparisons and hashes are consistent with `uuidv7`, and a view compares equal to
+/// the `uuidv7` holding the same bytes. The viewed bytes must outlive the view.
+class uuidv7_view {
+public:
+    /// @brief Create a view of 16 bytes without validation
+    /// @param bytes Pointer to 16 bytes holding a valid UUID Version 7 (must not be null)
+    /// @note For trusted data only; use `from_bytes()` to validate the version and variant.
+    constexpr explicit uuidv7_view(const std::uint8_t* bytes) noexcept : bytes_(bytes) {}
+
+    /// @brief Create a view of a `uuidv7` object
+    /// @param uuid `uuidv7` object (must outlive the view)
+    constexpr uuidv7_view(const uuidv7& uuid) noexcept : bytes_(uuid.data_.data()) {}
+
+    /// @brief Create a view of 16 bytes after validating them
+    /// @param bytes Pointer to 16 bytes
+    /// @return `uuidv7_view` object
+    /// @throw invalid_format_error if the bytes do not conform to UUID Version 7 format
+    static constexpr uuidv7_view from_bytes(const std::uint8_t* bytes) {
+        if (!bytes) throw invalid_format_error("Input pointer is null");
+        if (((bytes[6] >> 4) & 0b1111) != uuidv7::VERSION)
+            throw invalid_format_error("Invalid UUID Version 7 version");
+        if (((bytes[8] >> 6) & 0b11) != uuidv7::VARIANT)
+            throw invalid_format_error("Invalid UUID Version 7 variant");
+        return uuidv7_view(bytes);
+    }
+
+    /// @brief Get the viewed bytes
+    /// @return Pointer to the 16 viewed bytes
+    constexpr const std::uint8_t* data() const noexcept { return bytes_; }
+
+    /// @brief Copy the viewed bytes into a `uuidv7` object
+    /// @return `uuidv7` object
+    constexpr uuidv7 to_uuidv7() const noexcept { return uuidv7::from_bytes_unchecked(bytes_); }
+
+    /// @brief Get the 16-byte array representation
+    /// @return Copy of the viewed bytes
+    constexpr std::array<std::uint8_t, 16> get_bytes() const noexcept { return to_uuidv7().get_bytes(); }
+
+    /// @brief Convert to the standard string representation
+    /// @param include_hyphens Whether to include hyphens in the string representation (default: `true`)
+    /// @return UUID string representation
+    /// @note In C++17, this function is not constexpr due to `std::string` limitations.
+    CONSTEXPR_STRING std::string to_string(bool include_hyphens = true) const {
+        return detail::to_string(bytes_, include_hyphens);
+    }
+
+    /// @brief Get the 48-bit Unix timestamp in milliseconds (`unix_ts_ms` field)
+    /// @return Unix timestamp in milliseconds
+    constexpr std::uint64_t unix_ts_ms() const noexcept { return detail::load_be64(bytes_) >> 16; }
+
+    /// @brief Get the 12-bit `rand_a` field
+    /// @return Value of `rand_a`
+    constexpr std::uint16_t rand_a() const noexcept {
+        return static_cast<std::uint16_t>(detail::load_be64(bytes_) & uuidv7::MAX_RAND_A);
+    }
+
+    /// @brief Get the 62-bit `rand_b` field
+    /// @return Value of `rand_b`
+    constexpr std::uint64_t rand_b() const noexcept { return detail::load_be64(bytes_ + 8) & uuidv7::MAX_RAND_B; }
+
+    /// @brief Get the creation time
+    /// @return Time point of `unix_ts_ms`
+    constexpr std::chrono::system_clock::time_point time_point() const noexcept {
+        return std::chrono::system_clock::time_point(
+            std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::milliseconds(unix_ts_ms())));
+    }
+
+    /// @brief Get hash value (equal to the hash of the corresponding `uuidv7`)
+    /// @return Hash value
+    constexpr std::size_t get_hash() const noexcept { return detail::hash_bytes(bytes_); }
+
+private:
+    const std::uint8_t* bytes_;
+};
+
+
+// --- Operators ---
+/// @brief Equality operator for `uuidv7_view`
+inline bool operator==(uuidv7_view lhs, uuidv7_view rhs) {
+    return detail::load_be64(lhs.data()) == detail::load_be64(rhs.data()) &&
+           detail::load_be64(lhs.data() + 8) == detail::load_be64(rhs.data() + 8);
+}
+/// @brief Inequality operator for `uuidv7_view`
+inline bool operator!=(uuidv7_view lhs, uuidv7_view rhs) { return !(lhs == rhs); }
+
+/// @brief Less-than operator for `uuidv7_view`
+inline bool operator<(uuidv7_view lhs, uuidv7_view rhs) {
+    const std::uint64_t lhs_upper = detail::load_be64(lhs.data());
+    const std::uint64_t rhs_upper = detail::load_be64(rhs.data());
+    if (lhs_upper != rhs_upper) return lhs_upper < rhs_upper;
+    return detail::load_be64(lhs.data() + 8) < detail::load_be64(rhs.data() + 8);
+}
+/// @brief Greater-than operator for `uuidv7_view`
+inline bool operator>(uuidv7_view lhs, uuidv7_view rhs) { return rhs < lhs; }
+/// @brief Less-than-or-equal-to operator for `uuidv7_view`
+inline bool operator<=(uuidv7_view lhs, uuidv7_view rhs) { return !(rhs < lhs); }
+/// @brief Greater-than-or-equal-to operator for `uuidv7_view`
+inline bool operator>=(uuidv7_view lhs, uuidv7_view rhs) { return !(lhs < rhs); }
+
+/// @brief Output stream operator for `uuidv7_view`
+inline std::ostream& operator<<(std::ostream& os, uuidv7_view uuid) {
+    char buffer[36];
+    detail::write_hex(uuid.data(), true, false, buffer);
+    return os << std::string_view(buffer, sizeof(buffer)); // Formatted insert honors width and fill
+}
+
+} // namespace uuidv7
+
+/// @cond Doxygen_suppress
+namespace std {
+    template <>
+    struct hash<uuidv7::uuidv7_view> {
+        hash() = default;
+        hash(const hash&) = default;
+
+        size_t operator()(uuidv7::uuidv7_view u) const noexcept {
+            return u.get_hash();
+        }
+    };
+} // namespace std
+/// @endcond
+
+#if __cpp_lib_format >= 201907L
+namespace std {
+    /// @brief `std::format` support for `uuidv7_view` (same format spec as `uuidv7`)
+    template <>
+    struct formatter<uuidv7::uuidv7_view> : formatter<uuidv7::uuidv7> {
+        /// @cond Doxygen_suppress
+        template <class FormatContext>
+        auto format(uuidv7::uuidv7_view uuid, FormatContext& ctx) const {
+            return format_bytes(uuid.data(), ctx);
+        }
+        /// @endcond
+    };
+} // namespace std
+#endif
@@ -2,9 +2,15 @@
 #include <cstdint>
 #include <cstdlib>
 #include "uuidv7/generator.hpp"
+#include "os_ready.hpp"
 
-std::array<std::uint8_t, 10> uuidv7::uuidv7_generator::generate_random() {
+std::array<std::uint8_t, 10> uuidv7::csprng_entropy::operator()() {
     std::array<std::uint8_t, 10> buffer;
     arc4random_buf(buffer.data(), buffer.size());
     return buffer;
 };
+
+bool uuidv7::csprng_entropy::ready() noexcept {
+    // arc4random_buf never blocks on BSD and macOS, but glibc (2.36+) backs it with getrandom
+    return detail::os_entropy_ready();
+}
@@ -1,12 +1,14 @@
 #include <array>
+#include <atomic>
 #include <cstdint>
 #include <stdexcept>
 #include <string>
 #include <openssl/rand.h>
 #include <openssl/err.h>
 #include "uuidv7/generator.hpp"
+#include "os_ready.hpp"
 
-std::array<std::uint8_t, 10> uuidv7::uuidv7_generator::generate_random() {
+std::array<std::uint8_t, 10> uuidv7::csprng_entropy::operator()() {
     std::array<std::uint8_t, 10> buffer;
     if (RAND_bytes(reinterpret_cast<unsigned char*>(buffer.data()), buffer.size()) == 1)
         return buffer;
@@ -22,3 +24,13 @@ std::array<std::uint8_t, 10> uuidv7::uuidv7_generator::generate_random() {
     }
     throw std::runtime_error("RAND_bytes failed: " + error);
 };
+
+bool uuidv7::csprng_entropy::ready() noexcept {
+    // RAND_status() seeds the DRBG if needed, which waits for the OS at early boot:
+    // probe the OS without blocking first, so RAND_status() only runs once seeding cannot wait
+    static std::atomic<bool> seeded{false};
+    if (seeded.load(std::memory_order_relaxed)) return true;
+    if (!detail::os_entropy_ready() || RAND_status() != 1) return false;
+    seeded.store(true, std::memory_order_relaxed);
+    return true;
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+
+#if defined(__linux__) && __has_include(<sys/random.h>)
+    #include <sys/random.h>
+    #define UUIDV7LIB_GETRANDOM_PROBE
+#endif
+
+namespace uuidv7 {
+namespace detail {
+
+/// Check without blocking whether the OS entropy pool is initialized
+///
+/// Only Linux can block at early boot: `getrandom`, and the glibc `arc4random_buf` and
+/// OpenSSL seeding built on it, wait for the pool once. Other systems are always ready.
+/// Once the pool is initialized it stays so, so a successful probe is cached.
+inline bool os_entropy_ready() noexcept {
+#if defined(UUIDV7LIB_GETRANDOM_PROBE)
+    static std::atomic<bool> initialized{false};
+    if (initialized.load(std::memory_order_relaxed)) return true;
+    std::uint8_t probe;
+    ssize_t bytes_read;
+    do {
+        bytes_read = getrandom(&probe, 1, GRND_NONBLOCK);
+    } while (bytes_read < 0 && errno == EINTR);
+    // Only EAGAIN means waiting; other errors are reported by the CSPRNG call itself without blocking
+    if (bytes_read < 0 && errno == EAGAIN) return false;
+    initialized.store(true, std::memory_order_relaxed);
+    return true;
+#else
+    return true;
+#endif
+}
+
+} // namespace detail
+} // namespace uuidv7
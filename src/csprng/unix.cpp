@@ -4,8 +4,9 @@
 #include <system_error>
 #include <sys/random.h>
 #include "uuidv7/generator.hpp"
+#include "os_ready.hpp"
 
-std::array<std::uint8_t, 10> uuidv7::uuidv7_generator::generate_random() {
+std::array<std::uint8_t, 10> uuidv7::csprng_entropy::operator()() {
     std::array<std::uint8_t, 10> buffer;
     size_t bytes_read_total = 0;
 
@@ -22,3 +23,8 @@ std::array<std::uint8_t, 10> uuidv7::uuidv7_generator::generate_random() {
     }
     return buffer;
 };
+
+bool uuidv7::csprng_entropy::ready() noexcept {
+    // getrandom only blocks until the pool is initialized
+    return detail::os_entropy_ready();
+}
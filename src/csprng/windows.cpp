@@ -9,7 +9,7 @@
     #define BCRYPT_USE_SYSTEM_PREFERRED_RNG 2
 #endif
 
-std::array<std::uint8_t, 10> uuidv7::uuidv7_generator::generate_random() {
+std::array<std::uint8_t, 10> uuidv7::csprng_entropy::operator()() {
     std::array<std::uint8_t, 10> buffer;
     NTSTATUS status = BCryptGenRandom(NULL, reinterpret_cast<PUCHAR>(buffer.data()), buffer.size(), BCRYPT_USE_SYSTEM_PREFERRED_RNG);
     if (!BCRYPT_SUCCESS(status)) {
@@ -17,3 +17,8 @@ std::array<std::uint8_t, 10> uuidv7::uuidv7_generator::generate_random() {
     }
     return buffer;
 };
+
+bool uuidv7::csprng_entropy::ready() noexcept {
+    // BCryptGenRandom never blocks
+    return true;
+}
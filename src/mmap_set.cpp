@@ -0,0 +1,253 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "uuidv7/algorithm.hpp"
+#include "uuidv7/mmap_set.hpp"
+
+namespace uuidv7 {
+
+namespace {
+    constexpr std::uint32_t SET_MAGIC = 0x31533755; // "U7S1"
+    constexpr std::uint32_t SET_LAYOUT = 1;
+    constexpr std::size_t HEADER_SIZE = 64;
+
+    // Header field offsets
+    constexpr std::size_t MAGIC_OFFSET = 0;
+    constexpr std::size_t LAYOUT_OFFSET = 4;
+    constexpr std::size_t COUNT_OFFSET = 8;
+    constexpr std::size_t PAGE_SIZE_OFFSET = 16;
+    constexpr std::size_t PAGE_COUNT_OFFSET = 24;
+    constexpr std::size_t DATA_OFFSET_OFFSET = 32;
+
+    std::size_t data_offset(std::size_t page_count) {
+        std::size_t end = HEADER_SIZE + page_count * 8;
+        return (end + uuidv7_mmap_set::BYTES_PER_PAGE - 1) / uuidv7_mmap_set::BYTES_PER_PAGE * uuidv7_mmap_set::BYTES_PER_PAGE;
+    }
+
+    void put_le(std::uint8_t* p, std::uint64_t value, int bytes) {
+        for (int i = 0; i < bytes; i++) p[i] = static_cast<std::uint8_t>(value >> (i * 8));
+    }
+
+    std::uint64_t get_le(const std::uint8_t* p, int bytes) {
+        std::uint64_t value = 0;
+        for (int i = bytes - 1; i >= 0; i--) value = (value << 8) | p[i];
+        return value;
+    }
+
+    void write_all(int fd, const void* data, std::size_t size) {
+        const char* p = static_cast<const char*>(data);
+        while (size > 0) {
+            ssize_t written = ::write(fd, p, size);
+            if (written < 0) {
+                if (errno == EINTR) continue;
+                throw std::system_error(errno, std::generic_category(), "write failed to write set file");
+            }
+            p += written;
+            size -= static_cast<std::size_t>(written);
+        }
+    }
+
+    // Create a temporary file next to `path` that no other writer can share
+    int create_temp(const std::string& path, std::string& temp_path) {
+        static std::atomic<std::uint32_t> sequence{0};
+        for (int attempt = 0; attempt < 100; attempt++) {
+            temp_path = path + "." + std::to_string(getpid()) + "." +
+                        std::to_string(sequence.fetch_add(1, std::memory_order_relaxed)) + ".tmp";
+            int fd = open(temp_path.c_str(), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0644);
+            if (fd >= 0) return fd;
+            if (errno != EEXIST) break; // Leftovers of a crashed writer with the same pid are skipped
+        }
+        throw std::system_error(errno, std::generic_category(), "open failed to create set file");
+    }
+
+    // Make a rename in the directory of `path` durable
+    void sync_parent(const std::string& path) {
+        const std::size_t slash = path.find_last_of('/');
+        const std::string dir = slash == std::string::npos ? "." : slash == 0 ? "/" : path.substr(0, slash);
+        int fd = open(dir.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        if (fd < 0)
+            throw std::system_error(errno, std::generic_category(), "open failed to open set file directory");
+        if (fsync(fd) != 0) {
+            int err = errno;
+            close(fd);
+            throw std::system_error(err, std::generic_category(), "fsync failed to flush set file directory");
+        }
+        close(fd);
+    }
+}
+
+// uuidv7_mmap_set
+void uuidv7_mmap_set::write(const std::string& path, const uuidv7* first, const uuidv7* last) {
+    static_assert(sizeof(uuidv7) == 16, "uuidv7 must be 16 raw bytes");
+    std::vector<uuidv7> uuids(first, last);
+    sort_uuids(uuids.data(), uuids.data() + uuids.size());
+    uuids.erase(std::unique(uuids.begin(), uuids.end()), uuids.end());
+
+    const std::size_t page_count = (uuids.size() + UUIDS_PER_PAGE - 1) / UUIDS_PER_PAGE;
+    std::vector<std::uint8_t> head(data_offset(page_count), 0);
+    put_le(&head[MAGIC_OFFSET], SET_MAGIC, 4);
+    put_le(&head[LAYOUT_OFFSET], SET_LAYOUT, 4);
+    put_le(&head[COUNT_OFFSET], uuids.size(), 8);
+    put_le(&head[PAGE_SIZE_OFFSET], BYTES_PER_PAGE, 4);
+    put_le(&head[PAGE_COUNT_OFFSET], page_count, 8);
+    put_le(&head[DATA_OFFSET_OFFSET], head.size(), 8);
+    for (std::size_t page = 0; page < page_count; page++) {
+        std::array<std::uint8_t, 16> bytes = uuids[page * UUIDS_PER_PAGE].get_bytes();
+        std::memcpy(&head[HEADER_SIZE + page * 8], bytes.data(), 8);
+    }
+
+    std::string temp_path;
+    int fd = create_temp(path, temp_path);
+    try {
+        write_all(fd, head.data(), head.size());
+        write_all(fd, uuids.data(), uuids.size() * sizeof(uuidv7));
+        if (fsync(fd) != 0)
+            throw std::system_error(errno, std::generic_category(), "fsync failed to flush set file");
+    } catch (...) {
+        close(fd);
+        unlink(temp_path.c_str());
+        throw;
+    }
+    if (close(fd) != 0) {
+        int err = errno;
+        unlink(temp_path.c_str());
+        throw std::system_error(err, std::generic_category(), "close failed on set file");
+    }
+    if (std::rename(temp_path.c_str(), path.c_str()) != 0) {
+        int err = errno;
+        unlink(temp_path.c_str());
+        throw std::system_error(err, std::generic_category(), "rename failed to replace set file");
+    }
+    sync_parent(path);
+}
+
+uuidv7_mmap_set::uuidv7_mmap_set(const std::string& path) {
+    int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+        throw std::system_error(errno, std::generic_category(), "open failed to open set file");
+
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        int err = errno;
+        close(fd);
+        throw std::system_error(err, std::generic_category(), "fstat failed on set file");
+    }
+    map_size_ = static_cast<std::size_t>(st.st_size);
+    if (map_size_ < HEADER_SIZE) {
+        close(fd);
+        throw invalid_format_error("Invalid uuidv7 set file");
+    }
+    map_ = mmap(nullptr, map_size_, PROT_READ, MAP_SHARED, fd, 0);
+    int err = errno;
+    close(fd); // the mapping stays valid
+    if (map_ == MAP_FAILED) {
+        map_ = nullptr;
+        throw std::system_error(err, std::generic_category(), "mmap failed to map set file");
+    }
+
+    const auto* base = static_cast<const std::uint8_t*>(map_);
+    std::uint64_t count = get_le(base + COUNT_OFFSET, 8);
+    std::uint64_t page_count = get_le(base + PAGE_COUNT_OFFSET, 8);
+    std::uint64_t offset = get_le(base + DATA_OFFSET_OFFSET, 8);
+    if (get_le(base + MAGIC_OFFSET, 4) != SET_MAGIC || get_le(base + LAYOUT_OFFSET, 4) != SET_LAYOUT ||
+        get_le(base + PAGE_SIZE_OFFSET, 4) != BYTES_PER_PAGE ||
+        count > map_size_ / 16 || page_count != (count + UUIDS_PER_PAGE - 1) / UUIDS_PER_PAGE ||
+        offset != data_offset(static_cast<std::size_t>(page_count)) || map_size_ != offset + count * 16)
+    {
+        munmap(map_, map_size_);
+        map_ = nullptr;
+        throw invalid_format_error("Invalid uuidv7 set file");
+    }
+
+    count_ = static_cast<std::size_t>(count);
+    page_count_ = static_cast<std::size_t>(page_count);
+    index_ = base + HEADER_SIZE;
+    data_ = base + offset;
+    // Lookups touch scattered pages; read-ahead would only waste I/O
+    madvise(map_, map_size_, MADV_RANDOM);
+}
+
+uuidv7_mmap_set::uuidv7_mmap_set(uuidv7_mmap_set&& other) noexcept
+    : map_(other.map_), map_size_(other.map_size_), index_(other.index_), data_(other.data_),
+      count_(other.count_), page_count_(other.page_count_)
+{
+    other.map_ = nullptr;
+    other.map_size_ = 0;
+    other.index_ = nullptr;
+    other.data_ = nullptr;
+    other.count_ = 0;
+    other.page_count_ = 0;
+}
+
+uuidv7_mmap_set& uuidv7_mmap_set::operator=(uuidv7_mmap_set&& other) noexcept {
+    if (this != &other) {
+        if (map_) munmap(map_, map_size_);
+        map_ = other.map_;
+        map_size_ = other.map_size_;
+        index_ = other.index_;
+        data_ = other.data_;
+        count_ = other.count_;
+        page_count_ = other.page_count_;
+        other.map_ = nullptr;
+        other.map_size_ = 0;
+        other.index_ = nullptr;
+        other.data_ = nullptr;
+        other.count_ = 0;
+        other.page_count_ = 0;
+    }
+    return *this;
+}
+
+uuidv7_mmap_set::~uuidv7_mmap_set() {
+    if (map_) munmap(map_, map_size_);
+}
+
+uuidv7 uuidv7_mmap_set::at(std::size_t index) const {
+    if (index >= count_) throw std::out_of_range("uuidv7 set index is out of range");
+    return uuidv7::from_bytes(data_ + index * 16);
+}
+
+std::size_t uuidv7_mmap_set::lower_bound(const uuidv7& uuid) const noexcept {
+    const std::array<std::uint8_t, 16> key = uuid.get_bytes();
+    const std::uint64_t key_upper = detail::load_be64(key.data());
+
+    // Pages starting below the key, and pages starting at or below it.
+    // The answer lies between the last page of the first kind and the first page after the second.
+    std::size_t below = 0, at_or_below = 0;
+    for (std::size_t lo = 0, hi = page_count_; lo < hi;) {
+        std::size_t mid = lo + (hi - lo) / 2;
+        if (detail::load_be64(index_ + mid * 8) < key_upper) lo = below = mid + 1; else hi = mid;
+    }
+    at_or_below = below;
+    for (std::size_t lo = below, hi = page_count_; lo < hi;) {
+        std::size_t mid = lo + (hi - lo) / 2;
+        if (detail::load_be64(index_ + mid * 8) <= key_upper) lo = at_or_below = mid + 1; else hi = mid;
+    }
+
+    std::size_t first = below > 0 ? (below - 1) * UUIDS_PER_PAGE : 0;
+    std::size_t last = std::min(at_or_below * UUIDS_PER_PAGE, count_);
+    while (first < last) {
+        std::size_t mid = first + (last - first) / 2;
+        if (std::memcmp(data_ + mid * 16, key.data(), 16) < 0) first = mid + 1; else last = mid;
+    }
+    return first;
+}
+
+bool uuidv7_mmap_set::contains(const uuidv7& uuid) const noexcept {
+    std::size_t pos = lower_bound(uuid);
+    return pos < count_ && std::memcmp(data_ + pos * 16, uuid.get_bytes().data(), 16) == 0;
+}
+
+} // namespace uuidv7
@@ -0,0 +1,115 @@
+#include <array>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "uuidv7/persistent_generator.hpp"
+
+namespace uuidv7 {
+
+namespace {
+    constexpr std::uint32_t CHECKPOINT_MAGIC = 0x50444955; // "UIDP"
+    constexpr std::uint32_t CHECKPOINT_LAYOUT = 1;
+}
+
+struct persistent_uuidv7_generator::checkpoint {
+    std::uint32_t magic;
+    std::uint32_t layout;
+    std::uint64_t high_water_ms;
+};
+
+// persistent_uuidv7_generator
+persistent_uuidv7_generator::persistent_uuidv7_generator(const std::string& path, std::chrono::milliseconds interval)
+    : interval_ms_(interval.count() > 0 ? static_cast<std::uint64_t>(interval.count()) : 1)
+{
+    fd_ = open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0600);
+    if (fd_ < 0)
+        throw std::system_error(errno, std::generic_category(), "open failed to open generator state file");
+
+    auto fail = [this](int err, const char* message) {
+        close(fd_);
+        throw std::system_error(err, std::generic_category(), message);
+    };
+    if (flock(fd_, LOCK_EX | LOCK_NB) != 0)
+        fail(errno, "Generator state file is in use by another generator");
+
+    struct stat st;
+    if (fstat(fd_, &st) != 0)
+        fail(errno, "fstat failed on generator state file");
+    if (static_cast<size_t>(st.st_size) < sizeof(checkpoint) && ftruncate(fd_, sizeof(checkpoint)) != 0)
+        fail(errno, "Failed to size generator state file");
+
+    void* addr = mmap(nullptr, sizeof(checkpoint), PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+    if (addr == MAP_FAILED)
+        fail(errno, "mmap failed to map generator state file");
+    checkpoint_ = static_cast<checkpoint*>(addr);
+
+    if (checkpoint_->magic == 0) {
+        checkpoint_->magic = CHECKPOINT_MAGIC;
+        checkpoint_->layout = CHECKPOINT_LAYOUT;
+        checkpoint_->high_water_ms = 0;
+    } else if (checkpoint_->magic != CHECKPOINT_MAGIC || checkpoint_->layout != CHECKPOINT_LAYOUT) {
+        munmap(checkpoint_, sizeof(checkpoint));
+        close(fd_);
+        throw std::runtime_error("Generator state file has an incompatible format");
+    }
+
+    // Resume at the high-water mark: every UUID emitted before has a smaller timestamp.
+    std::uint64_t resume_ms = checkpoint_->high_water_ms;
+    if (resume_ms > 0) {
+        std::array<std::uint8_t, 10> rand;
+        try {
+            rand = csprng_entropy()();
+        } catch (...) {
+            // The destructor does not run: release the mapping and the file lock here
+            munmap(checkpoint_, sizeof(checkpoint));
+            close(fd_);
+            throw;
+        }
+        std::array<std::uint8_t, 16> bytes = {};
+        for (int i = 0; i < 6; i++) bytes[i] = static_cast<std::uint8_t>(resume_ms >> (40 - i * 8));
+        for (int i = 0; i < 10; i++) bytes[6 + i] = rand[i];
+        // Keep the top bit of the counter clear to leave headroom for increments
+        bytes[6] = (bytes[6] & 0x07) | (uuidv7::VERSION << 4);
+        bytes[8] = (bytes[8] & 0x3F) | (uuidv7::VARIANT << 6);
+        generator_ = generator_type(uuidv7::from_bytes(bytes));
+    }
+}
+
+persistent_uuidv7_generator::~persistent_uuidv7_generator() {
+    munmap(checkpoint_, sizeof(checkpoint));
+    close(fd_);
+}
+
+uuidv7 persistent_uuidv7_generator::generate() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    uuidv7 result = generator_.generate();
+    if (result.unix_ts_ms() >= checkpoint_->high_water_ms)
+        persist(result.unix_ts_ms() + interval_ms_);
+    return result;
+}
+
+std::uint64_t persistent_uuidv7_generator::high_water_mark() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return checkpoint_->high_water_ms;
+}
+
+void persistent_uuidv7_generator::persist(std::uint64_t high_water_ms) {
+    std::uint64_t previous = checkpoint_->high_water_ms;
+    checkpoint_->high_water_ms = high_water_ms;
+    if (msync(checkpoint_, sizeof(checkpoint), MS_SYNC) != 0) {
+        int err = errno;
+        checkpoint_->high_water_ms = previous;
+        throw std::system_error(err, std::generic_category(), "msync failed to flush generator state file");
+    }
+}
+
+} // namespace uuidv7
@@ -0,0 +1,133 @@
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "uuidv7/shared_generator.hpp"
+
+namespace uuidv7 {
+
+namespace {
+    constexpr std::uint32_t SHARED_STATE_MAGIC = 0x37444955; // "UID7"
+    constexpr std::uint32_t SHARED_STATE_LAYOUT = 1;
+
+    // Random bits are refreshed once per millisecond per thread, like the
+    // random seed of increment_counter; uniqueness comes from the shared sequence.
+    thread_local std::uint64_t random_ms = 0;
+    thread_local std::uint64_t random_bits = 0;
+}
+
+struct shared_uuidv7_generator::shared_state {
+    std::atomic<std::uint32_t> magic;
+    std::atomic<std::uint32_t> layout;
+    // unix_ts_ms (48bit) << 16 | sequence (16bit)
+    std::atomic<std::uint64_t> word;
+};
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free, "Shared state requires lock-free 64-bit atomics");
+
+// shared_uuidv7_generator
+shared_uuidv7_generator shared_uuidv7_generator::open_shared_memory(const std::string& name) {
+    int fd = shm_open(name.c_str(), O_RDWR | O_CREAT, 0600);
+    if (fd < 0)
+        throw std::system_error(errno, std::generic_category(), "shm_open failed to open shared memory object");
+    return shared_uuidv7_generator(fd);
+}
+
+shared_uuidv7_generator shared_uuidv7_generator::open_file(const std::string& path) {
+    int fd = open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0600);
+    if (fd < 0)
+        throw std::system_error(errno, std::generic_category(), "open failed to open generator state file");
+    return shared_uuidv7_generator(fd);
+}
+
+bool shared_uuidv7_generator::remove_shared_memory(const std::string& name) noexcept {
+    return shm_unlink(name.c_str()) == 0;
+}
+
+shared_uuidv7_generator::shared_uuidv7_generator(int fd) {
+    struct stat st;
+    if (fstat(fd, &st) != 0 ||
+        (static_cast<size_t>(st.st_size) < sizeof(shared_state) && ftruncate(fd, sizeof(shared_state)) != 0)) {
+        int err = errno;
+        close(fd);
+        throw std::system_error(err, std::generic_category(), "Failed to size generator shared state");
+    }
+
+    void* addr = mmap(nullptr, sizeof(shared_state), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    int err = errno;
+    close(fd);
+    if (addr == MAP_FAILED)
+        throw std::system_error(err, std::generic_category(), "mmap failed to map generator shared state");
+    state_ = static_cast<shared_state*>(addr);
+
+    // A freshly created region is zero-filled, which is a valid initial state.
+    std::uint32_t magic = 0;
+    if (!state_->magic.compare_exchange_strong(magic, SHARED_STATE_MAGIC) && magic != SHARED_STATE_MAGIC) {
+        munmap(state_, sizeof(shared_state));
+        state_ = nullptr;
+        throw std::runtime_error("Generator shared state has an unknown format");
+    }
+    std::uint32_t layout = 0;
+    if (!state_->layout.compare_exchange_strong(layout, SHARED_STATE_LAYOUT) && layout != SHARED_STATE_LAYOUT) {
+        munmap(state_, sizeof(shared_state));
+        state_ = nullptr;
+        throw std::runtime_error("Generator shared state has an incompatible layout version");
+    }
+}
+
+shared_uuidv7_generator::shared_uuidv7_generator(shared_uuidv7_generator&& other) noexcept
+    : state_(other.state_), entropy_(other.entropy_)
+{
+    other.state_ = nullptr;
+}
+
+shared_uuidv7_generator& shared_uuidv7_generator::operator=(shared_uuidv7_generator&& other) noexcept {
+    if (this != &other) {
+        if (state_) munmap(state_, sizeof(shared_state));
+        state_ = other.state_;
+        other.state_ = nullptr;
+    }
+    return *this;
+}
+
+shared_uuidv7_generator::~shared_uuidv7_generator() {
+    if (state_) munmap(state_, sizeof(shared_state));
+}
+
+uuidv7 shared_uuidv7_generator::generate() {
+    auto now_duration = std::chrono::system_clock::now().time_since_epoch();
+    auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(now_duration).count();
+    std::uint64_t now_ms = static_cast<std::uint64_t>(millis) & 0xFFFFFFFFFFFF;
+
+    std::uint64_t current = state_->word.load(std::memory_order_relaxed);
+    std::uint64_t next;
+    do {
+        if (now_ms > (current >> 16)) {
+            next = now_ms << 16;
+        } else if ((current & 0xFFFF) < 0xFFFF) {
+            next = current + 1;
+        } else {
+            throw sequence_overflow_error("Too many UUIDs generated in the same millisecond; sequence counter overflowed.");
+        }
+    } while (!state_->word.compare_exchange_weak(current, next, std::memory_order_relaxed));
+
+    if (random_ms != (next >> 16)) {
+        auto rand = entropy_();
+        random_bits = 0;
+        for (int i = 2; i < 10; i++) random_bits = (random_bits << 8) | rand[i];
+        random_ms = next >> 16;
+    }
+
+    std::uint16_t sequence = static_cast<std::uint16_t>(next & 0xFFFF);
+    return uuidv7(next >> 16,
+                  static_cast<std::uint16_t>(sequence >> 4),
+                  (static_cast<std::uint64_t>(sequence & 0x0F) << 58) | (random_bits & 0x03FFFFFFFFFFFFFF));
+}
+
+} // namespace uuidv7
@@ -1,12 +1,43 @@
+#include <algorithm>
 #include <array>
+#include <chrono>
 #include <cstdint>
 #include <cstring>
+#include <iomanip>
 #include <optional>
+#include <random>
+#include <sstream>
+#include <stdexcept>
 #include <string>
+#include <system_error>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
+#include <vector>
 #include <gtest/gtest.h>
 #include "uuidv7/uuidv7.hpp"
+#include "uuidv7/algorithm.hpp"
+#include "uuidv7/column_codec.hpp"
+#include "uuidv7/concurrent_map.hpp"
+#include "uuidv7/dedup.hpp"
+#include "uuidv7/filter.hpp"
+#include "uuidv7/flat_hash.hpp"
 #include "uuidv7/generator.hpp"
+#include "uuidv7/partition.hpp"
+#include "uuidv7/scan.hpp"
+#include "uuidv7/time_index.hpp"
+#include "uuidv7/validate.hpp"
+#include "uuidv7/view.hpp"
+#ifdef UUIDV7LIB_TEST_FMT
+    #include "uuidv7/fmt.hpp"
+#endif
+#ifndef _WIN32
+    #include <unistd.h>
+    #include "uuidv7/mmap_set.hpp"
+    #include "uuidv7/persistent_generator.hpp"
+    #include "uuidv7/shared_generator.hpp"
+#endif
 
 TEST(UUIDv7, Generate)
 {
@@ -83,6 +114,46 @@ TEST(UUIDv7, ConvertString)
     EXPECT_EQ(converted_str2.length(), 36);
 }
 
+TEST(UUIDv7, ConvertStringForms)
+{
+    const uuidv7::uuidv7 uuid = uuidv7::uuidv7::parse("01965347-e56d-7571-a1bb-6120dba3a645");
+
+    // from string (upper case, braces, URN)
+    EXPECT_EQ(uuidv7::uuidv7::parse("01965347-E56D-7571-A1BB-6120DBA3A645"), uuid);
+    EXPECT_EQ(uuidv7::uuidv7::parse("{01965347-e56d-7571-a1bb-6120dba3a645}"), uuid);
+    EXPECT_EQ(uuidv7::uuidv7::parse("{01965347e56d7571a1bb6120dba3a645}"), uuid);
+    EXPECT_EQ(uuidv7::uuidv7::parse("urn:uuid:01965347-e56d-7571-a1bb-6120dba3a645"), uuid);
+    EXPECT_EQ(uuidv7::uuidv7::parse("URN:UUID:01965347-E56D-7571-A1BB-6120DBA3A645"), uuid);
+    static_assert(uuidv7::uuidv7::parse("{01965347-e56d-7571-a1bb-6120dba3a645}").rand_b() == 0x21bb6120dba3a645);
+
+    // from string (invalid forms)
+    EXPECT_FALSE(uuidv7::uuidv7::try_parse("{01965347-e56d-7571-a1bb-6120dba3a645"));
+    EXPECT_FALSE(uuidv7::uuidv7::try_parse("(01965347-e56d-7571-a1bb-6120dba3a645)"));
+    EXPECT_FALSE(uuidv7::uuidv7::try_parse("urn:uid:001965347-e56d-7571-a1bb-6120dba3a645"));
+    EXPECT_FALSE(uuidv7::uuidv7::try_parse("urn:uuid:01965347e56d7571a1bb6120dba3a645"));
+    EXPECT_FALSE(uuidv7::uuidv7::try_parse("urn:uuid:01965347-e56d-7571-a1bb-6120dba3a64g"));
+    EXPECT_FALSE(uuidv7::uuidv7::try_parse("{75f50a24-995d-4606-bf3e-7f6c5b76c5c1}")); // version 4
+
+    // to string (all forms)
+    using style = uuidv7::uuidv7::string_style;
+    char buffer[45];
+    auto written = [&](style s, bool upper) {
+        auto result = uuid.to_chars(buffer, buffer + sizeof(buffer), s, upper);
+        EXPECT_EQ(result.ec, std::errc());
+        return std::string(buffer, result.ptr);
+    };
+    EXPECT_EQ(written(style::hyphenated, false), "01965347-e56d-7571-a1bb-6120dba3a645");
+    EXPECT_EQ(written(style::compact, true), "01965347E56D7571A1BB6120DBA3A645");
+    EXPECT_EQ(written(style::braced, false), "{01965347-e56d-7571-a1bb-6120dba3a645}");
+    EXPECT_EQ(written(style::urn, true), "urn:uuid:01965347-E56D-7571-A1BB-6120DBA3A645");
+    for (style s : { style::hyphenated, style::compact, style::braced, style::urn })
+        EXPECT_EQ(uuidv7::uuidv7::parse(written(s, true)), uuid);
+
+    // to string (buffer too small)
+    EXPECT_EQ(uuid.to_chars(buffer, buffer + 44, style::urn).ec, std::errc::value_too_large);
+    EXPECT_EQ(uuid.to_chars(buffer, buffer + 32, style::compact).ec, std::errc());
+}
+
 TEST(UUIDv7, ConvertBytes)
 {
     std::optional<uuidv7::uuidv7> opt_uuid;
@@ -165,6 +236,60 @@ TEST(UUIDv7, ConvertError)
     ASSERT_THROW(uuidv7::uuidv7::from_bytes(nullptr), uuidv7::invalid_format_error);
 }
 
+TEST(UUIDv7, ParseEx)
+{
+    using uuidv7::uuidv7;
+    using Result = uuidv7::ParseResult;
+
+    auto ex = uuidv7::parse_ex("01965347-e56d-7571-a1bb-6120dba3a645");
+    ASSERT_TRUE(ex);
+    EXPECT_EQ(ex.result, Result::Success);
+    EXPECT_EQ(ex.error_offset, 0u);
+    EXPECT_EQ(ex.value, uuidv7::parse("01965347-e56d-7571-a1bb-6120dba3a645"));
+    static_assert(uuidv7::parse_ex("{01965347-e56d-7571-a1bb-6120dba3a645}").value.rand_a() == 0x571);
+
+    auto check = [](std::string_view str, Result result, std::size_t offset) {
+        auto ex = uuidv7::parse_ex(str);
+        EXPECT_FALSE(ex) << str;
+        EXPECT_EQ(ex.result, result) << str;
+        EXPECT_EQ(ex.error_offset, offset) << str;
+    };
+    check("01965347-e56d-7571-a1bb-", Result::InvalidFormat, 24);
+    check("01965347-e56d-7571_a1bb-6120dba3a645", Result::InvalidFormat, 18);
+    check("01965347-e56d-7571-a1bb-6120dba3a64Z", Result::InvalidFormat, 35);
+    check("0196534x-e56d-7571-a1bb-6120dba3a64Z", Result::InvalidFormat, 7);
+    check("75f50a24-995d-4606-bf3e-7f6c5b76c5c1", Result::InvalidVersion, 14);
+    check("01965347e56d7571-1bb6120dba3a645", Result::InvalidFormat, 16);
+    check("{01965347-e56d-7571-01bb-6120dba3a645}", Result::InvalidVariant, 20);
+    check("urn:uuid:01965347-e56d-7571-a1bb-6120dba3a6g5", Result::InvalidFormat, 43);
+    check("urn:uid::01965347-e56d-7571-a1bb-6120dba3a645", Result::InvalidFormat, 5);
+}
+
+TEST(UUIDv7, Fields)
+{
+    constexpr uuidv7::uuidv7 uuid = uuidv7::uuidv7::parse("01965347-e56d-7571-a1bb-6120dba3a645");
+    static_assert(uuid.unix_ts_ms() == 0x01965347e56d);
+    static_assert(uuid.rand_a() == 0x571);
+    static_assert(uuid.rand_b() == 0x21bb6120dba3a645);
+
+    EXPECT_EQ(uuid.unix_ts_ms(), 0x01965347e56d);
+    EXPECT_EQ(uuid.rand_a(), 0x571);
+    EXPECT_EQ(uuid.rand_b(), 0x21bb6120dba3a645);
+    EXPECT_EQ(std::chrono::duration_cast<std::chrono::milliseconds>(uuid.time_point().time_since_epoch()).count(), 0x01965347e56d);
+
+    // time bounds
+    auto tp = uuid.time_point() + std::chrono::microseconds(999);
+    uuidv7::uuidv7 min_uuid = uuidv7::uuidv7::min_for_time(tp);
+    uuidv7::uuidv7 max_uuid = uuidv7::uuidv7::max_for_time(tp);
+    EXPECT_EQ(min_uuid.to_string(), "01965347-e56d-7000-8000-000000000000");
+    EXPECT_EQ(max_uuid.to_string(), "01965347-e56d-7fff-bfff-ffffffffffff");
+    EXPECT_LT(min_uuid, uuid);
+    EXPECT_GT(max_uuid, uuid);
+
+    EXPECT_THROW(uuidv7::uuidv7::min_for_time(std::chrono::system_clock::time_point(std::chrono::milliseconds(-1))), std::out_of_range);
+    EXPECT_THROW(uuidv7::uuidv7::max_for_time(std::chrono::time_point<std::chrono::system_clock, std::chrono::milliseconds>(std::chrono::milliseconds(0x1000000000000))), std::out_of_range);
+}
+
 TEST(UUIDv7, AdditionalMonotonicity)
 {
     uuidv7::uuidv7 uuid = uuidv7::uuidv7_generator::generate_default();
@@ -174,3 +299,1228 @@ TEST(UUIDv7, AdditionalMonotonicity)
         uuid = std::move(next_uuid);
     }
 }
+
+namespace {
+    struct fixed_clock {
+        using duration = std::chrono::milliseconds;
+        using time_point = std::chrono::time_point<std::chrono::system_clock, duration>;
+        static inline std::int64_t millis = 0x0418'46e8'1c98;
+        static time_point now() noexcept { return time_point(duration(millis)); }
+    };
+
+    struct fixed_entropy {
+        std::array<std::uint8_t, 10> operator()() const noexcept {
+            return { 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0 };
+        }
+    };
+
+    // entropy that is only available once `available` is set
+    struct pending_entropy {
+        static inline bool available = false;
+        bool ready() const noexcept { return available; }
+        std::array<std::uint8_t, 10> operator()() const noexcept { return {}; }
+    };
+
+    // lock that always looks held by another thread to try_lock()
+    struct contended_lock {
+        void lock() noexcept {}
+        bool try_lock() noexcept { return false; }
+        void unlock() noexcept {}
+    };
+
+    // counter policy without advance(), so reserve() increments one by one
+    struct stepping_counter {
+        uuidv7::increment_counter counter;
+        template <class Entropy>
+        void seed(std::uint16_t& rand_a, std::uint64_t& rand_b, Entropy& entropy) { counter.seed(rand_a, rand_b, entropy); }
+        void increment(std::uint16_t& rand_a, std::uint64_t& rand_b) { counter.increment(rand_a, rand_b); }
+    };
+
+#if defined(UUIDV7LIB_COROUTINES)
+    // minimal eagerly started coroutine
+    struct eager_task {
+        struct promise_type {
+            eager_task get_return_object() noexcept { return {}; }
+            std::suspend_never initial_suspend() noexcept { return {}; }
+            std::suspend_never final_suspend() noexcept { return {}; }
+            void return_void() noexcept {}
+            void unhandled_exception() { std::terminate(); }
+        };
+    };
+#endif
+}
+
+TEST(UUIDv7, GeneratePolicies)
+{
+    // single-thread generator with coarse clock
+    uuidv7::basic_uuidv7_generator<uuidv7::coarse_system_clock, uuidv7::csprng_entropy, uuidv7::null_lock, uuidv7::increment_counter> st_generator;
+    uuidv7::uuidv7 uuid = st_generator.generate();
+    for (int i = 0; i < 1000; i++) {
+        uuidv7::uuidv7 next_uuid = st_generator.generate();
+        EXPECT_GT(next_uuid, uuid);
+        uuid = next_uuid;
+    }
+
+    // deterministic clock and entropy with spin lock
+    fixed_clock::millis = 0x0418'46e8'1c98;
+    uuidv7::basic_uuidv7_generator<fixed_clock, fixed_entropy, uuidv7::spin_lock, uuidv7::increment_counter> generator;
+    EXPECT_EQ(generator.generate().to_string(), "041846e8-1c98-7ffe-bfff-fffffffffff0");
+    EXPECT_EQ(generator.generate().to_string(), "041846e8-1c98-7ffe-bfff-fffffffffff1");
+    for (int i = 0; i < 14; i++) generator.generate();
+    EXPECT_EQ(generator.generate().to_string(), "041846e8-1c98-7fff-8000-000000000000");
+
+    // clock moved backwards: keep incrementing the last timestamp
+    fixed_clock::millis -= 10;
+    EXPECT_EQ(generator.generate().to_string(), "041846e8-1c98-7fff-8000-000000000001");
+    fixed_clock::millis += 11;
+    EXPECT_EQ(generator.generate().to_string(), "041846e8-1c99-7ffe-bfff-fffffffffff0");
+}
+
+TEST(UUIDv7, TryGenerate)
+{
+    uuidv7::uuidv7_generator generator;
+    std::optional<uuidv7::uuidv7> uuid = generator.try_generate();
+    ASSERT_TRUE(uuid.has_value());
+    EXPECT_GT(generator.generate(), *uuid);
+    EXPECT_TRUE(uuidv7::csprng_entropy::ready());
+
+    // contended lock: fail fast, while the blocking call still works
+    fixed_clock::millis = 0x0418'46e8'1c98;
+    uuidv7::basic_uuidv7_generator<fixed_clock, fixed_entropy, contended_lock, uuidv7::increment_counter> contended;
+    EXPECT_FALSE(contended.try_generate().has_value());
+    EXPECT_EQ(contended.generate().to_string(), "041846e8-1c98-7ffe-bfff-fffffffffff0");
+
+    // entropy not ready: only a new millisecond needs it
+    pending_entropy::available = false;
+    uuidv7::basic_uuidv7_generator<fixed_clock, pending_entropy, uuidv7::null_lock, uuidv7::increment_counter> pending;
+    EXPECT_FALSE(pending.try_generate().has_value());
+    pending_entropy::available = true;
+    EXPECT_EQ(pending.try_generate()->to_string(), "041846e8-1c98-7000-8000-000000000000");
+    pending_entropy::available = false;
+    EXPECT_EQ(pending.try_generate()->to_string(), "041846e8-1c98-7000-8000-000000000001");
+    fixed_clock::millis++;
+    EXPECT_FALSE(pending.try_generate().has_value());
+
+#if defined(UUIDV7LIB_COROUTINES)
+    // no suspension when try_generate() succeeds; otherwise generate() runs on the executor
+    std::vector<uuidv7::uuidv7> results;
+    std::size_t scheduled = 0;
+    auto inline_executor = [&](auto work) { scheduled++; work(); };
+    [&]() -> eager_task {
+        results.push_back(co_await generator.async_generate(inline_executor));
+        results.push_back(co_await contended.async_generate(inline_executor));
+    }();
+    ASSERT_EQ(results.size(), 2);
+    EXPECT_EQ(scheduled, 1);
+    EXPECT_EQ(results[1].to_string(), "041846e8-1c99-7ffe-bfff-fffffffffff0");
+
+    // thread executor: resumed on the worker thread, which is joined before checking (the
+    // coroutine reads its captures through the closure, so the closure must outlive the resumption)
+    std::thread worker;
+    std::thread::id resumed_on;
+    auto resume_elsewhere = [&]() -> eager_task {
+        results.push_back(co_await contended.async_generate([&](auto work) { worker = std::thread(std::move(work)); }));
+        resumed_on = std::this_thread::get_id();
+    };
+    resume_elsewhere();
+    worker.join();
+    EXPECT_NE(resumed_on, std::this_thread::get_id());
+    EXPECT_GT(results[2], results[1]);
+#endif
+}
+
+TEST(UUIDv7, GenerateShard)
+{
+    fixed_clock::millis = 0x0418'46e8'1c99;
+
+    // counter-only configuration: no CSPRNG, 10-bit shard ID 0x2a5
+    uuidv7::basic_uuidv7_generator<fixed_clock, uuidv7::no_entropy, uuidv7::null_lock, uuidv7::shard_counter>
+        generator({}, uuidv7::shard_counter(10, 0x2a5));
+    EXPECT_EQ(generator.generate().to_string(), "041846e8-1c99-7000-aa50-000000000000");
+    EXPECT_EQ(generator.generate().to_string(), "041846e8-1c99-7000-aa50-000000000001");
+
+    uuidv7::uuidv7 uuid = generator.generate();
+    for (int i = 0; i < 1000; i++) {
+        uuidv7::uuidv7 next_uuid = generator.generate();
+        EXPECT_GT(next_uuid, uuid);
+        EXPECT_EQ(generator.counter().shard_of(next_uuid), 0x2a5);
+        uuid = next_uuid;
+    }
+    EXPECT_EQ(uuidv7::shard_counter::shard_of(uuid, 10), 0x2a5);
+
+    // random seed keeps the shard ID and carries into rand_a on overflow
+    uuidv7::basic_uuidv7_generator<fixed_clock, fixed_entropy, uuidv7::null_lock, uuidv7::shard_counter>
+        random_generator({}, uuidv7::shard_counter(48, 0x123456789abc));
+    EXPECT_EQ(random_generator.generate().to_string(), "041846e8-1c99-7ffe-848d-159e26af3ff0");
+    for (int i = 0; i < 15; i++) random_generator.generate();
+    EXPECT_EQ(random_generator.generate().to_string(), "041846e8-1c99-7fff-848d-159e26af0000");
+
+    // resumed after a restart from the last issued ID: stays above it within the same millisecond
+    uuidv7::basic_uuidv7_generator<fixed_clock, uuidv7::no_entropy, uuidv7::null_lock, uuidv7::shard_counter>
+        resumed(uuid, {}, uuidv7::shard_counter(10, 0x2a5));
+    uuidv7::uuidv7 resumed_uuid = resumed.generate();
+    EXPECT_EQ(resumed_uuid.unix_ts_ms(), uuid.unix_ts_ms());
+    EXPECT_EQ(resumed_uuid.rand_b(), uuid.rand_b() + 1);
+    EXPECT_EQ(resumed.counter().shard_of(resumed_uuid), 0x2a5);
+
+    // invalid layout
+    EXPECT_THROW(uuidv7::shard_counter(0, 0), std::invalid_argument);
+    EXPECT_THROW(uuidv7::shard_counter(49, 0), std::invalid_argument);
+    EXPECT_THROW(uuidv7::shard_counter(4, 16), std::invalid_argument);
+}
+
+TEST(UUIDv7, Reserve)
+{
+    fixed_clock::millis = 0x0418'46e8'1c9a;
+
+    // a lease holds exactly what consecutive generate() calls would return, across the carry into rand_a
+    uuidv7::basic_uuidv7_generator<fixed_clock, fixed_entropy, uuidv7::null_lock, uuidv7::increment_counter> expected, generator;
+    auto lease = generator.reserve(20);
+    EXPECT_EQ(lease.remaining(), 20);
+    EXPECT_EQ(lease.unix_ts_ms(), 0x0418'46e8'1c9a);
+    for (int i = 0; i < 20; i++) EXPECT_EQ(lease.next(), expected.generate());
+    EXPECT_TRUE(lease.empty());
+    EXPECT_THROW(lease.next(), std::out_of_range);
+    EXPECT_EQ(generator.generate(), expected.generate());
+    EXPECT_THROW(generator.reserve(0), std::invalid_argument);
+
+    // leases of the shard layout keep the shard ID
+    uuidv7::basic_uuidv7_generator<fixed_clock, fixed_entropy, uuidv7::null_lock, uuidv7::shard_counter>
+        expected_shard({}, uuidv7::shard_counter(48, 0x123456789abc)), shard({}, uuidv7::shard_counter(48, 0x123456789abc));
+    auto shard_lease = shard.reserve(20);
+    for (int i = 0; i < 20; i++) EXPECT_EQ(shard_lease.next(), expected_shard.generate());
+    EXPECT_EQ(shard.generate(), expected_shard.generate());
+
+    // counter policies without advance()
+    uuidv7::basic_uuidv7_generator<fixed_clock, fixed_entropy, uuidv7::null_lock, stepping_counter> stepping;
+    auto stepping_lease = stepping.reserve(20);
+    EXPECT_EQ(stepping_lease.next().to_string(), "041846e8-1c9a-7ffe-bfff-fffffffffff0");
+    EXPECT_EQ(stepping.generate().to_string(), "041846e8-1c9a-7fff-8000-000000000004");
+
+    // the whole counter range of a millisecond, then overflow
+    fixed_clock::millis++;
+    uuidv7::basic_uuidv7_generator<fixed_clock, fixed_entropy, uuidv7::null_lock, uuidv7::increment_counter> full;
+    EXPECT_THROW(full.reserve((std::size_t(1) << 62) + 17), uuidv7::sequence_overflow_error);
+    auto full_lease = full.reserve((std::size_t(1) << 62) + 16);
+    EXPECT_EQ(full_lease.next().to_string(), "041846e8-1c9b-7ffe-bfff-fffffffffff0");
+    EXPECT_THROW(full.generate(), uuidv7::sequence_overflow_error);
+
+    // workers turn their leases into IDs without synchronization
+    uuidv7::uuidv7_generator shared;
+    std::vector<std::vector<uuidv7::uuidv7>> produced(4);
+    std::vector<std::thread> workers;
+    for (auto& out : produced) {
+        workers.emplace_back([&shared, &out] {
+            for (int block = 0; block < 10; block++) {
+                auto worker_lease = shared.reserve(100);
+                while (!worker_lease.empty()) out.push_back(worker_lease.next());
+            }
+        });
+    }
+    for (auto& worker : workers) worker.join();
+    std::unordered_set<uuidv7::uuidv7> unique;
+    for (const auto& out : produced) {
+        EXPECT_TRUE(std::is_sorted(out.begin(), out.end()));
+        unique.insert(out.begin(), out.end());
+    }
+    EXPECT_EQ(unique.size(), 4000);
+}
+
+#ifndef _WIN32
+TEST(UUIDv7, GenerateShared)
+{
+    // Two handles to the same shared memory object share one monotonic sequence
+    std::string name = "/uuidv7lib_test_" + std::to_string(getpid());
+    auto generator1 = uuidv7::shared_uuidv7_generator::open_shared_memory(name);
+    auto generator2 = uuidv7::shared_uuidv7_generator::open_shared_memory(name);
+    EXPECT_TRUE(uuidv7::shared_uuidv7_generator::remove_shared_memory(name));
+
+    uuidv7::uuidv7 uuid = generator1.generate();
+    EXPECT_EQ((uuid.get_bytes()[6] >> 4) & 0x0F, 7); // Version
+    EXPECT_EQ((uuid.get_bytes()[8] >> 6) & 0x03, 2); // Variant
+    for (int i = 0; i < 1000; i++) {
+        uuidv7::uuidv7 next_uuid = (i % 2 == 0 ? generator2 : generator1).generate();
+        EXPECT_GT(next_uuid, uuid);
+        uuid = next_uuid;
+    }
+
+    // File-backed state survives reopening
+    std::string path = ::testing::TempDir() + "uuidv7lib_test_shared_" + std::to_string(getpid());
+    uuidv7::uuidv7 last = uuidv7::shared_uuidv7_generator::open_file(path).generate();
+    EXPECT_GT(uuidv7::shared_uuidv7_generator::open_file(path).generate(), last);
+    unlink(path.c_str());
+}
+#endif
+
+#ifndef _WIN32
+TEST(UUIDv7, GeneratePersistent)
+{
+    std::string path = ::testing::TempDir() + "uuidv7lib_test_persistent_" + std::to_string(getpid());
+    // Smallest UUID: another generator may be in the same millisecond and ahead of this one
+    uuidv7::uuidv7 last = uuidv7::uuidv7::parse("00000000-0000-7000-8000-000000000000");
+    std::uint64_t high_water_mark = 0;
+    {
+        uuidv7::persistent_uuidv7_generator generator(path, std::chrono::hours(24));
+        EXPECT_EQ(generator.high_water_mark(), 0);
+        for (int i = 0; i < 100; i++) {
+            uuidv7::uuidv7 uuid = generator.generate();
+            EXPECT_GT(uuid, last);
+            last = uuid;
+        }
+        high_water_mark = generator.high_water_mark();
+        EXPECT_GT(high_water_mark, 0);
+
+        // The state file is exclusive to one generator
+        EXPECT_THROW(uuidv7::persistent_uuidv7_generator{ path }, std::system_error);
+    }
+
+    // Restarted generator resumes at the high-water mark (one day ahead of the clock)
+    uuidv7::persistent_uuidv7_generator generator(path, std::chrono::hours(24));
+    uuidv7::uuidv7 uuid = generator.generate();
+    EXPECT_GT(uuid, last);
+    EXPECT_EQ(uuid.unix_ts_ms(), high_water_mark);
+    EXPECT_GT(generator.high_water_mark(), high_water_mark);
+    unlink(path.c_str());
+}
+#endif
+
+#ifndef _WIN32
+TEST(UUIDv7, MmapSet)
+{
+    using ms_time_point = std::chrono::time_point<std::chrono::system_clock, std::chrono::milliseconds>;
+    auto at = [](std::int64_t millis) { return ms_time_point(std::chrono::milliseconds(millis)); };
+    std::string path = ::testing::TempDir() + "uuidv7lib_test_set_" + std::to_string(getpid());
+
+    // 3000 UUIDs: 1000 per millisecond in [1000, 1003), so one timestamp spans several pages
+    fixed_clock::millis = 1000;
+    uuidv7::basic_uuidv7_generator<fixed_clock, uuidv7::csprng_entropy, uuidv7::null_lock, uuidv7::increment_counter> generator;
+    std::vector<uuidv7::uuidv7> uuids;
+    for (int i = 0; i < 3000; i++) {
+        if (i % 1000 == 0) fixed_clock::millis = 1000 + i / 1000;
+        uuids.push_back(generator.generate());
+    }
+    std::vector<uuidv7::uuidv7> input(uuids.rbegin(), uuids.rend());
+    input.push_back(uuids[5]);
+    uuidv7::uuidv7_mmap_set::write(path, input.data(), input.data() + input.size());
+
+    uuidv7::uuidv7_mmap_set set(path);
+    ASSERT_EQ(set.size(), 3000);
+    for (std::size_t i = 0; i < uuids.size(); i++) {
+        EXPECT_EQ(set.lower_bound(uuids[i]), i);
+        EXPECT_TRUE(set.contains(uuids[i]));
+    }
+    EXPECT_EQ(set.at(1234), uuids[1234]);
+    EXPECT_EQ(set[1234], uuids[1234]);
+    EXPECT_THROW(set.at(3000), std::out_of_range);
+    EXPECT_FALSE(set.contains(uuidv7::uuidv7::min_for_time(at(1001))));
+    EXPECT_EQ(set.lower_bound(uuidv7::uuidv7::max_for_time(at(1002))), 3000);
+
+    // time ranges (inclusive)
+    auto range = set.find_range(at(1001), at(1001));
+    EXPECT_EQ(range.first, 1000);
+    EXPECT_EQ(range.second, 2000);
+    EXPECT_EQ(set.count_range(at(0), at(5000)), 3000);
+    EXPECT_EQ(set.count_range(at(1002), at(1001)), 0);
+
+    // rewriting replaces the file; an open set keeps its mapping
+    uuidv7::uuidv7_mmap_set::write(path, uuids.data(), uuids.data());
+    uuidv7::uuidv7_mmap_set empty(path);
+    EXPECT_TRUE(empty.empty());
+    EXPECT_EQ(empty.count_range(at(0), at(5000)), 0);
+    EXPECT_EQ(set.size(), 3000);
+    EXPECT_TRUE(set.contains(uuids[2999]));
+
+    uuidv7::uuidv7_mmap_set moved = std::move(set);
+    EXPECT_TRUE(moved.contains(uuids[0]));
+    EXPECT_EQ(set.size(), 0);
+
+    // concurrent writers of the same path never leave a mix of their files in place
+    std::vector<std::thread> writers;
+    for (std::size_t w = 1; w <= 4; w++) {
+        writers.emplace_back([&, w] {
+            for (int round = 0; round < 10; round++) uuidv7::uuidv7_mmap_set::write(path, uuids.data(), uuids.data() + w * 700);
+        });
+    }
+    for (auto& writer : writers) writer.join();
+    uuidv7::uuidv7_mmap_set written(path);
+    EXPECT_EQ(written.size() % 700, 0);
+    for (std::size_t i = 0; i < written.size(); i++) ASSERT_EQ(written.at(i), uuids[i]);
+
+    truncate(path.c_str(), 32);
+    EXPECT_THROW(uuidv7::uuidv7_mmap_set{ path }, uuidv7::invalid_format_error);
+    unlink(path.c_str());
+    EXPECT_THROW(uuidv7::uuidv7_mmap_set{ path }, std::system_error);
+}
+#endif
+
+TEST(UUIDv7, View)
+{
+    // two UUIDs packed in one buffer
+    std::array<uint8_t, 32> buffer = {};
+    uuidv7::uuidv7 first = uuidv7::uuidv7::parse("01809424-3e59-7c05-9219-566f82fff672");
+    uuidv7::uuidv7 second = uuidv7::uuidv7::parse("01809424-3e59-7c05-9219-566f82fff673");
+    std::memcpy(buffer.data(), first.get_bytes().data(), 16);
+    std::memcpy(buffer.data() + 16, second.get_bytes().data(), 16);
+
+    uuidv7::uuidv7_view view(buffer.data());
+    EXPECT_EQ(view.data(), buffer.data());
+    EXPECT_EQ(view.to_string(), first.to_string());
+    EXPECT_EQ(view.to_string(false), first.to_string(false));
+    EXPECT_EQ(view.unix_ts_ms(), first.unix_ts_ms());
+    EXPECT_EQ(view.rand_a(), first.rand_a());
+    EXPECT_EQ(view.rand_b(), first.rand_b());
+    EXPECT_EQ(view.time_point(), first.time_point());
+    EXPECT_EQ(view.get_bytes(), first.get_bytes());
+    EXPECT_EQ(view.to_uuidv7(), first);
+    EXPECT_EQ(std::hash<uuidv7::uuidv7_view>()(view), std::hash<uuidv7::uuidv7>()(first));
+
+    // comparison with views and uuidv7 objects
+    uuidv7::uuidv7_view next = uuidv7::uuidv7_view::from_bytes(buffer.data() + 16);
+    EXPECT_TRUE(view == first);
+    EXPECT_TRUE(first == view);
+    EXPECT_TRUE(view != next);
+    EXPECT_TRUE(view < next);
+    EXPECT_TRUE(view < second);
+    EXPECT_TRUE(next > view);
+    EXPECT_TRUE(view <= first);
+    EXPECT_TRUE(next >= second);
+
+    // the view aliases the buffer
+    buffer[15] = 0x74;
+    EXPECT_EQ(view.to_string(), "01809424-3e59-7c05-9219-566f82fff674");
+
+    EXPECT_EQ(uuidv7::uuidv7::from_bytes_unchecked(buffer.data() + 16), second);
+    buffer[6] = 0x4c;
+    EXPECT_THROW(uuidv7::uuidv7_view::from_bytes(buffer.data()), uuidv7::invalid_format_error);
+    EXPECT_THROW(uuidv7::uuidv7_view::from_bytes(nullptr), uuidv7::invalid_format_error);
+}
+
+TEST(UUIDv7, Base32Base64url)
+{
+    uuidv7::uuidv7 uuid = uuidv7::uuidv7::parse("01809424-3e59-7c05-9219-566f82fff672");
+    EXPECT_EQ(uuid.to_base32(), "01G2A28FJSFG2S46APDY1FZXKJ");
+    EXPECT_EQ(uuid.to_base64url(), "AYCUJD5ZfAWSGVZvgv_2cg");
+    EXPECT_EQ(uuidv7::uuidv7::parse_base32("01G2A28FJSFG2S46APDY1FZXKJ"), uuid);
+    EXPECT_EQ(uuidv7::uuidv7::parse_base32("01g2a28fjsfg2s46apdy1fzxkj"), uuid);
+    EXPECT_EQ(uuidv7::uuidv7::parse_base32("O1G2A28FJSFG2S46APDY1FZXKJ"), uuid);
+    EXPECT_EQ(uuidv7::uuidv7::parse_base64url("AYCUJD5ZfAWSGVZvgv_2cg"), uuid);
+
+    // non-allocating variants
+    std::array<char, 32> buffer = {};
+    auto result = uuid.to_chars_base32(buffer.data(), buffer.data() + buffer.size());
+    EXPECT_EQ(result.ec, std::errc());
+    EXPECT_EQ(std::string(buffer.data(), result.ptr), "01G2A28FJSFG2S46APDY1FZXKJ");
+    result = uuid.to_chars_base64url(buffer.data(), buffer.data() + buffer.size());
+    EXPECT_EQ(std::string(buffer.data(), result.ptr), "AYCUJD5ZfAWSGVZvgv_2cg");
+    EXPECT_EQ(uuid.to_chars_base64url(buffer.data(), buffer.data() + 21).ec, std::errc::value_too_large);
+
+    // invalid strings
+    EXPECT_THROW(uuidv7::uuidv7::parse_base32("81G2A28FJSFG2S46APDY1FZXKJ"), uuidv7::invalid_format_error);
+    EXPECT_THROW(uuidv7::uuidv7::parse_base32("01G2A28FJSFG2S46APDY1FZXKU"), uuidv7::invalid_format_error);
+    EXPECT_THROW(uuidv7::uuidv7::parse_base32("01G2A28FJSFG2S46APDY1FZXK"), uuidv7::invalid_format_error);
+    EXPECT_THROW(uuidv7::uuidv7::parse_base64url("AYCUJD5ZfAWSGVZvgv_2ch"), uuidv7::invalid_format_error);
+    EXPECT_THROW(uuidv7::uuidv7::parse_base64url("AYCUJD5ZfAWSGVZvgv+2cg"), uuidv7::invalid_format_error);
+    EXPECT_FALSE(uuidv7::uuidv7::try_parse_base32("00000000000000000000000000").has_value());
+    EXPECT_FALSE(uuidv7::uuidv7::try_parse_base64url("AAAAAAAAAAAAAAAAAAAAAA").has_value());
+
+    // round trips, and Base32 preserves the sort order
+    std::vector<uuidv7::uuidv7> uuids;
+    std::vector<std::string> encoded;
+    for (int i = 0; i < 1000; i++) {
+        uuids.push_back(uuidv7::uuidv7_generator::generate_default());
+        encoded.push_back(uuids.back().to_base32());
+        EXPECT_EQ(uuidv7::uuidv7::parse_base32(encoded.back()), uuids.back());
+        EXPECT_EQ(uuidv7::uuidv7::try_parse_base64url(uuids.back().to_base64url()), uuids.back());
+    }
+    std::shuffle(uuids.begin(), uuids.end(), std::mt19937_64(7));
+    std::sort(uuids.begin(), uuids.end());
+    std::sort(encoded.begin(), encoded.end());
+    for (std::size_t i = 0; i < uuids.size(); i++) EXPECT_EQ(uuids[i].to_base32(), encoded[i]);
+
+    static_assert(uuidv7::uuidv7::parse_base32("01G2A28FJSFG2S46APDY1FZXKJ").rand_b() == 0x1219566f82fff672);
+}
+
+TEST(UUIDv7, Format)
+{
+    uuidv7::uuidv7 uuid = uuidv7::uuidv7::parse("01809424-3e59-7c05-9219-566f82fff672");
+    std::ostringstream stream;
+    stream << uuid << ' ' << uuidv7::uuidv7_view(uuid);
+    EXPECT_EQ(stream.str(), "01809424-3e59-7c05-9219-566f82fff672 01809424-3e59-7c05-9219-566f82fff672");
+
+    // width and fill apply to the UUID, not to the next insertion
+    std::ostringstream padded;
+    padded << std::setw(40) << std::left << std::setfill('.') << uuid << '|' << std::setw(38) << uuidv7::uuidv7_view(uuid) << '|';
+    EXPECT_EQ(padded.str(), "01809424-3e59-7c05-9219-566f82fff672....|01809424-3e59-7c05-9219-566f82fff672..|");
+
+#if __cpp_lib_format >= 201907L
+    EXPECT_EQ(std::format("{}", uuid), "01809424-3e59-7c05-9219-566f82fff672");
+    EXPECT_EQ(std::format("{:X}", uuid), "01809424-3E59-7C05-9219-566F82FFF672");
+    EXPECT_EQ(std::format("{:n}", uuid), "018094243e597c059219566f82fff672");
+    EXPECT_EQ(std::format("{:bX}", uuid), "{01809424-3E59-7C05-9219-566F82FFF672}");
+    EXPECT_EQ(std::format("{:c}", uuid), "01G2A28FJSFG2S46APDY1FZXKJ");
+    EXPECT_EQ(std::format("{:n}", uuidv7::uuidv7_view(uuid)), "018094243e597c059219566f82fff672");
+    EXPECT_THROW((void)std::vformat("{:q}", std::make_format_args(uuid)), std::format_error);
+    EXPECT_THROW((void)std::vformat("{:cX}", std::make_format_args(uuid)), std::format_error);
+#endif
+#ifdef UUIDV7LIB_TEST_FMT
+    EXPECT_EQ(fmt::format("{}", uuid), "01809424-3e59-7c05-9219-566f82fff672");
+    EXPECT_EQ(fmt::format("{:x}", uuid), "01809424-3e59-7c05-9219-566f82fff672");
+    EXPECT_EQ(fmt::format("{:X}", uuid), "01809424-3E59-7C05-9219-566F82FFF672");
+    EXPECT_EQ(fmt::format("{:nX}", uuid), "018094243E597C059219566F82FFF672");
+    EXPECT_EQ(fmt::format("{:b}", uuid), "{01809424-3e59-7c05-9219-566f82fff672}");
+    EXPECT_EQ(fmt::format("{:c}", uuid), "01G2A28FJSFG2S46APDY1FZXKJ");
+    EXPECT_EQ(fmt::format("[{:bn}]", uuidv7::uuidv7_view(uuid)), "[{018094243e597c059219566f82fff672}]");
+    EXPECT_THROW((void)fmt::format(fmt::runtime("{:q}"), uuid), fmt::format_error);
+    EXPECT_THROW((void)fmt::format(fmt::runtime("{:bc}"), uuid), fmt::format_error);
+#endif
+}
+
+TEST(UUIDv7, ULID)
+{
+    // version and variant bits are overwritten, the rest is kept in place
+    constexpr uuidv7::uuidv7 uuid = uuidv7::uuidv7::parse_ulid("01ARZ3NDEKTSV4RRFFQ69G5FAV");
+    static_assert(uuid.unix_ts_ms() == 0x01563e3ab5d3);
+    EXPECT_EQ(uuid.to_string(), "01563e3a-b5d3-7676-8c61-efb99302bd5b");
+    EXPECT_EQ(uuidv7::uuidv7::parse_ulid("01arz3ndektsv4rrffq69g5fav"), uuid);
+    EXPECT_EQ(uuidv7::uuidv7::try_parse_ulid("01ARZ3NDEKTSV4RRFFQ69G5FAV"), uuid);
+    EXPECT_THROW(uuidv7::uuidv7::parse_ulid("81ARZ3NDEKTSV4RRFFQ69G5FAV"), uuidv7::invalid_format_error);
+    EXPECT_THROW(uuidv7::uuidv7::parse_ulid("01ARZ3NDEKTSV4RRFFQ69G5FA"), uuidv7::invalid_format_error);
+    EXPECT_FALSE(uuidv7::uuidv7::try_parse_ulid("01ARZ3NDEKTSV4RRFFQ69G5FA!").has_value());
+
+    std::array<uint8_t, 16> ulid = { 0x01, 0x56, 0x3e, 0x3a, 0xb5, 0xd3, 0xd6, 0x76, 0x4c, 0x61, 0xef, 0xb9, 0x93, 0x02, 0xbd, 0x5b };
+    EXPECT_EQ(uuidv7::uuidv7::from_ulid(ulid), uuid);
+    EXPECT_EQ(uuidv7::uuidv7::from_ulid(ulid.data()), uuid);
+
+    // uuidv7 -> ULID -> uuidv7 is lossless, and the ULID string is the Base32 form
+    for (int i = 0; i < 100; i++) {
+        uuidv7::uuidv7 generated = uuidv7::uuidv7_generator::generate_default();
+        EXPECT_EQ(uuidv7::uuidv7::from_ulid(generated.to_ulid()), generated);
+        EXPECT_EQ(uuidv7::uuidv7::parse_ulid(generated.to_base32()), generated);
+    }
+}
+
+TEST(UUIDv7, ValidateMany)
+{
+    std::vector<uuidv7::uuidv7> uuids;
+    for (int i = 0; i < 1000; i++) uuids.push_back(uuidv7::uuidv7_generator::generate_default());
+    std::vector<uint8_t> buffer(uuids.size() * 16);
+    for (std::size_t i = 0; i < uuids.size(); i++) std::memcpy(&buffer[i * 16], uuids[i].get_bytes().data(), 16);
+
+    std::vector<std::uint64_t> bitmap((uuids.size() + 63) / 64, ~0ull);
+    EXPECT_EQ(uuidv7::validate_many(buffer.data(), uuids.size()), uuids.size());
+    EXPECT_EQ(uuidv7::validate_many(buffer.data(), uuids.size(), bitmap.data()), 0);
+    EXPECT_EQ(std::count(bitmap.begin(), bitmap.end(), 0), bitmap.size());
+    EXPECT_EQ(uuidv7::validate_many(buffer.data(), 0), 0);
+
+    // wrong version, wrong variant, both wrong
+    buffer[517 * 16 + 6] = 0x4c;
+    buffer[518 * 16 + 8] = 0xc2;
+    buffer[999 * 16 + 6] = 0x00;
+    buffer[999 * 16 + 8] = 0x00;
+    EXPECT_EQ(uuidv7::validate_many(buffer.data(), uuids.size()), 517);
+    EXPECT_EQ(uuidv7::validate_many(buffer.data(), 517), 517);
+    EXPECT_EQ(uuidv7::validate_many(buffer.data() + 518 * 16, 10), 0);
+    EXPECT_EQ(uuidv7::validate_many(buffer.data(), uuids.size(), bitmap.data()), 3);
+    EXPECT_EQ(bitmap[517 / 64], (1ull << (517 % 64)) | (1ull << (518 % 64)));
+    EXPECT_EQ(bitmap[999 / 64], 1ull << (999 % 64));
+
+    // same results as from_bytes for arbitrary bytes
+    std::mt19937_64 rng(7);
+    for (std::size_t i = 0; i < uuids.size(); i++) {
+        if (rng() & 1) buffer[i * 16 + 6] ^= static_cast<uint8_t>(1 << (4 + rng() % 4));
+        if (rng() & 1) buffer[i * 16 + 8] ^= static_cast<uint8_t>(1 << (6 + rng() % 2));
+    }
+    uuidv7::validate_many(buffer.data(), uuids.size(), bitmap.data());
+    for (std::size_t i = 0; i < uuids.size(); i++) {
+        bool invalid = (bitmap[i / 64] >> (i % 64)) & 1;
+        bool throws = false;
+        try { uuidv7::uuidv7::from_bytes(&buffer[i * 16]); } catch (const uuidv7::invalid_format_error&) { throws = true; }
+        EXPECT_EQ(invalid, throws);
+    }
+}
+
+TEST(UUIDv7, FindUUIDs)
+{
+    using found_list = std::vector<std::pair<uuidv7::uuidv7, std::uint64_t>>;
+    const std::string a = "01965347-e56d-7571-a1bb-6120dba3a645";
+    const std::string b = "01965347-E56D-7571-A1BB-6120DBA3A646";
+    std::string text = a + " req=" + b + "\n"
+        "v4=75f50a24-995d-4606-bf3e-7f6c5b76c5c1 "       // version 4
+        "var=01965347-e56d-7571-01bb-6120dba3a645 "      // invalid variant
+        "hex=f01965347-e56d-7571-a1bb-6120dba3a645 "     // inside a longer hex run
+        "id=\"" + a + "\",last=" + b;
+    const found_list expected = {
+        { uuidv7::uuidv7::parse(a), 0 },
+        { uuidv7::uuidv7::parse(b), 41 },
+        { uuidv7::uuidv7::parse(a), text.size() - 36 - 7 - 36 },
+        { uuidv7::uuidv7::parse(b), text.size() - 36 },
+    };
+
+    found_list found;
+    auto collect = [&](const uuidv7::uuidv7& uuid, std::uint64_t offset) { found.emplace_back(uuid, offset); };
+    EXPECT_EQ(uuidv7::find_uuids(text, collect), 4);
+    EXPECT_EQ(found, expected);
+    EXPECT_EQ(uuidv7::find_uuids(std::string_view(text).substr(1, 35), collect), 0);
+
+    // same tokens whatever the chunk boundaries
+    for (std::size_t chunk_size = 1; chunk_size <= 80; chunk_size++) {
+        found.clear();
+        uuidv7::uuidv7_scanner scanner;
+        std::size_t count = 0;
+        for (std::size_t i = 0; i < text.size(); i += chunk_size)
+            count += scanner.feed(std::string_view(text).substr(i, chunk_size), collect);
+        EXPECT_EQ(scanner.offset(), text.size());
+        count += scanner.finish(collect);
+        EXPECT_EQ(count, 4) << chunk_size;
+        EXPECT_EQ(found, expected) << chunk_size;
+    }
+}
+
+TEST(UUIDv7, FlatSet)
+{
+    // counter-based generator output: runs of consecutive rand_b values
+    std::vector<uuidv7::uuidv7> uuids;
+    uuidv7::uuidv7_generator generator;
+    for (int i = 0; i < 20000; i++) uuids.push_back(generator.generate());
+
+    uuidv7::uuidv7_flat_set<> set;
+    EXPECT_TRUE(set.empty());
+    EXPECT_FALSE(set.contains(uuids[0]));
+    EXPECT_EQ(set.begin(), set.end());
+    for (const auto& uuid : uuids) EXPECT_TRUE(set.insert(uuid).second);
+    EXPECT_FALSE(set.insert(uuids[123]).second);
+    EXPECT_EQ(*set.insert(uuids[123]).first, uuids[123]);
+    EXPECT_EQ(set.size(), uuids.size());
+    EXPECT_LE(set.size(), set.capacity() - set.capacity() / 8);
+    EXPECT_EQ(static_cast<std::size_t>(std::distance(set.begin(), set.end())), uuids.size());
+    for (const auto& uuid : uuids) ASSERT_TRUE(set.contains(uuid));
+    EXPECT_EQ(*set.find(uuids[42]), uuids[42]);
+
+    // random inserts and erases against std::unordered_set
+    std::unordered_set<uuidv7::uuidv7> reference(uuids.begin(), uuids.end());
+    std::mt19937_64 rng(44);
+    for (int i = 0; i < 200000; i++) {
+        const auto& uuid = uuids[rng() % uuids.size()];
+        if (rng() & 1) ASSERT_EQ(set.erase(uuid), reference.erase(uuid));
+        else ASSERT_EQ(set.insert(uuid).second, reference.insert(uuid).second);
+    }
+    ASSERT_EQ(set.size(), reference.size());
+    for (const auto& uuid : uuids) ASSERT_EQ(set.count(uuid), reference.count(uuid));
+    for (const auto& uuid : set) ASSERT_EQ(reference.count(uuid), 1);
+
+    // copy, move, clear, reserve
+    uuidv7::uuidv7_flat_set<> copy = set;
+    EXPECT_EQ(copy.size(), set.size());
+    EXPECT_TRUE(copy.contains(*set.begin()));
+    uuidv7::uuidv7_flat_set<> moved = std::move(copy);
+    EXPECT_EQ(moved.size(), set.size());
+    set.clear();
+    EXPECT_TRUE(set.empty());
+    EXPECT_FALSE(set.contains(uuids[0]));
+    uuidv7::uuidv7_flat_set<> reserved(1000);
+    std::size_t capacity = reserved.capacity();
+    for (int i = 0; i < 1000; i++) reserved.insert(uuids[i]);
+    EXPECT_EQ(reserved.capacity(), capacity);
+
+    // any hash function
+    uuidv7::uuidv7_flat_set<std::hash<uuidv7::uuidv7>> std_hashed(uuids.begin(), uuids.end());
+    EXPECT_EQ(std_hashed.size(), uuids.size());
+    EXPECT_TRUE(std_hashed.contains(uuids.back()));
+}
+
+TEST(UUIDv7, FlatMap)
+{
+    std::vector<uuidv7::uuidv7> uuids;
+    uuidv7::uuidv7_generator generator;
+    for (int i = 0; i < 5000; i++) uuids.push_back(generator.generate());
+
+    uuidv7::uuidv7_flat_map<std::string> map;
+    for (int i = 0; i < 5000; i++) map[uuids[i]] = std::to_string(i);
+    EXPECT_EQ(map.size(), 5000);
+    EXPECT_EQ(map.at(uuids[17]), "17");
+    EXPECT_THROW(map.at(uuidv7::uuidv7::from_fields(1, 2, 3)), std::out_of_range);
+    EXPECT_FALSE(map.try_emplace(uuids[17], "x").second);
+    EXPECT_EQ(map.find(uuids[17])->second, "17");
+    EXPECT_FALSE(map.insert_or_assign(uuids[17], "y").second);
+    EXPECT_EQ(map.at(uuids[17]), "y");
+    EXPECT_TRUE(map.insert({ uuidv7::uuidv7::from_fields(1, 2, 3), "z" }).second);
+    EXPECT_EQ(map.erase(uuidv7::uuidv7::from_fields(1, 2, 3)), 1);
+    EXPECT_EQ(map.erase(uuidv7::uuidv7::from_fields(1, 2, 3)), 0);
+
+    for (int i = 0; i < 5000; i += 2) map.erase(uuids[i]);
+    EXPECT_EQ(map.size(), 2500);
+    std::size_t visited = 0;
+    for (auto& entry : map) {
+        entry.second += "!";
+        visited++;
+    }
+    EXPECT_EQ(visited, 2500);
+    const auto& const_map = map;
+    EXPECT_EQ(const_map.at(uuids[1]), "1!");
+    EXPECT_EQ(const_map.find(uuids[2]), const_map.end());
+    uuidv7::uuidv7_flat_map<std::string>::const_iterator it = map.find(uuids[3]);
+    EXPECT_EQ(it->second, "3!");
+
+    // a throwing value copy leaves nothing constructed behind
+    struct tracked {
+        int* live;
+        int* copies_left;
+        tracked(int* l, int* c) : live(l), copies_left(c) { ++*live; }
+        tracked(const tracked& other) : live(other.live), copies_left(other.copies_left) {
+            if ((*copies_left)-- == 0) throw std::runtime_error("copy failed");
+            ++*live;
+        }
+        ~tracked() { --*live; }
+    };
+    int live = 0, copies_left = 1 << 30;
+    {
+        uuidv7::uuidv7_flat_map<tracked> tracked_map;
+        for (int i = 0; i < 1000; i++) tracked_map.try_emplace(uuids[i], &live, &copies_left);
+        EXPECT_EQ(live, 1000);
+        copies_left = 100;
+        EXPECT_THROW(uuidv7::uuidv7_flat_map<tracked>{ tracked_map }, std::runtime_error);
+        EXPECT_EQ(live, 1000);
+    }
+    EXPECT_EQ(live, 0);
+}
+
+TEST(UUIDv7, DedupWindow)
+{
+    using status = uuidv7::uuidv7_dedup_window::status;
+    auto at = [](std::uint64_t millis, std::uint64_t rand_b) { return uuidv7::uuidv7::from_fields(millis, 0, rand_b); };
+
+    uuidv7::uuidv7_dedup_window window(std::chrono::milliseconds(3000), std::chrono::milliseconds(1000));
+    EXPECT_EQ(window.insert(at(10000, 1)), status::inserted);
+    EXPECT_EQ(window.insert(at(10000, 1)), status::duplicate);
+    EXPECT_EQ(window.insert(at(10500, 2)), status::inserted);
+    EXPECT_EQ(window.insert(at(9000, 3)), status::inserted); // older but within the window
+    EXPECT_EQ(window.size(), 3);
+    EXPECT_TRUE(window.contains(at(9000, 3)));
+    EXPECT_FALSE(window.contains(at(9000, 4)));
+    EXPECT_FALSE(window.contains(at(20000, 1)));
+
+    // the newest timestamp moves the window: everything within 3 s of it is still remembered
+    EXPECT_EQ(window.insert(at(12999, 4)), status::inserted);
+    EXPECT_EQ(window.insert(at(10000, 1)), status::duplicate);
+    EXPECT_EQ(window.insert(at(13500, 5)), status::inserted);
+    EXPECT_EQ(window.insert(at(10500, 2)), status::duplicate);
+    EXPECT_EQ(window.insert(at(9999, 6)), status::expired);
+    EXPECT_FALSE(window.contains(at(9000, 3)));
+    EXPECT_EQ(window.size(), 4);
+
+    // a jump past the whole window drops everything
+    EXPECT_EQ(window.insert(at(60000, 7)), status::inserted);
+    EXPECT_EQ(window.size(), 1);
+    EXPECT_EQ(window.insert(at(13500, 5)), status::expired);
+
+    // wall-clock expiry during idle periods
+    using ms_time_point = std::chrono::time_point<std::chrono::system_clock, std::chrono::milliseconds>;
+    window.advance_to(ms_time_point(std::chrono::milliseconds(62000)));
+    EXPECT_TRUE(window.contains(at(60000, 7)));
+    window.advance_to(ms_time_point(std::chrono::milliseconds(64000)));
+    EXPECT_FALSE(window.contains(at(60000, 7)));
+    EXPECT_EQ(window.size(), 0);
+
+    window.clear();
+    EXPECT_EQ(window.insert(at(1000, 1)), status::inserted);
+    EXPECT_THROW(uuidv7::uuidv7_dedup_window(std::chrono::milliseconds(1000), std::chrono::milliseconds(0)), std::invalid_argument);
+
+    // generator output: every ID is new exactly once
+    uuidv7::uuidv7_dedup_window live(std::chrono::minutes(1));
+    uuidv7::uuidv7_generator generator;
+    std::vector<uuidv7::uuidv7> uuids;
+    for (int i = 0; i < 10000; i++) uuids.push_back(generator.generate());
+    for (const auto& uuid : uuids) ASSERT_EQ(live.insert(uuid), status::inserted);
+    for (const auto& uuid : uuids) ASSERT_EQ(live.insert(uuid), status::duplicate);
+    EXPECT_EQ(live.size(), uuids.size());
+}
+
+TEST(UUIDv7, BloomFilter)
+{
+    // counter-based generator output: consecutive rand_b values must still spread over the blocks
+    std::vector<uuidv7::uuidv7> uuids;
+    uuidv7::uuidv7_generator generator;
+    for (int i = 0; i < 100000; i++) uuids.push_back(generator.generate());
+    std::vector<uuidv7::uuidv7> absent;
+    for (int i = 0; i < 100000; i++) absent.push_back(generator.generate());
+
+    uuidv7::uuidv7_bloom_filter filter(uuids.size());
+    EXPECT_EQ(filter.block_count(), (uuids.size() * 10 + 255) / 256);
+    EXPECT_FALSE(filter.contains(uuids[0]));
+    for (const auto& uuid : uuids) filter.insert(uuid);
+    for (const auto& uuid : uuids) ASSERT_TRUE(filter.contains(uuid));
+    std::size_t false_positives = 0;
+    for (const auto& uuid : absent) false_positives += filter.contains(uuid);
+    EXPECT_LT(false_positives, absent.size() / 50);
+
+    // serialized form, copied or read in place
+    const std::vector<std::uint8_t>& bytes = filter.bytes();
+    EXPECT_EQ(bytes.size(), 64 + filter.block_count() * 32);
+    EXPECT_EQ(std::memcmp(bytes.data(), "U7B1", 4), 0);
+    uuidv7::uuidv7_bloom_filter loaded = uuidv7::uuidv7_bloom_filter::from_bytes(bytes.data(), bytes.size());
+    uuidv7::uuidv7_bloom_filter_view view(bytes.data(), bytes.size());
+    EXPECT_EQ(view.block_count(), filter.block_count());
+    for (std::size_t i = 0; i < uuids.size(); i += 97) {
+        ASSERT_TRUE(loaded.contains(uuids[i]));
+        ASSERT_TRUE(view.contains(uuids[i]));
+    }
+    for (std::size_t i = 0; i < absent.size(); i += 97) {
+        ASSERT_EQ(loaded.contains(absent[i]), filter.contains(absent[i]));
+        ASSERT_EQ(view.contains(absent[i]), filter.contains(absent[i]));
+    }
+    EXPECT_THROW(uuidv7::uuidv7_bloom_filter_view(bytes.data(), 63), uuidv7::invalid_format_error);
+    EXPECT_THROW(uuidv7::uuidv7_bloom_filter_view(bytes.data(), bytes.size() - 1), uuidv7::invalid_format_error);
+    std::vector<std::uint8_t> corrupt = bytes;
+    corrupt[0] = 'X';
+    EXPECT_THROW(uuidv7::uuidv7_bloom_filter::from_bytes(corrupt.data(), corrupt.size()), uuidv7::invalid_format_error);
+
+    filter.clear();
+    EXPECT_FALSE(filter.contains(uuids[0]));
+    EXPECT_EQ(uuidv7::uuidv7_bloom_filter(0).block_count(), 1);
+    EXPECT_THROW(uuidv7::uuidv7_bloom_filter(100, 0), std::invalid_argument);
+}
+
+TEST(UUIDv7, CuckooFilter)
+{
+    std::vector<uuidv7::uuidv7> uuids;
+    uuidv7::uuidv7_generator generator;
+    for (int i = 0; i < 50000; i++) uuids.push_back(generator.generate());
+    std::vector<uuidv7::uuidv7> absent;
+    for (int i = 0; i < 50000; i++) absent.push_back(generator.generate());
+
+    uuidv7::uuidv7_cuckoo_filter filter(uuids.size());
+    EXPECT_GE(filter.capacity(), uuids.size());
+    for (const auto& uuid : uuids) ASSERT_TRUE(filter.insert(uuid));
+    EXPECT_EQ(filter.size(), uuids.size());
+    for (const auto& uuid : uuids) ASSERT_TRUE(filter.contains(uuid));
+    std::size_t false_positives = 0;
+    for (const auto& uuid : absent) false_positives += filter.contains(uuid);
+    EXPECT_LT(false_positives, absent.size() / 1000);
+
+    // erase half: the other half is still found
+    for (std::size_t i = 0; i < uuids.size(); i += 2) ASSERT_TRUE(filter.erase(uuids[i]));
+    EXPECT_EQ(filter.size(), uuids.size() / 2);
+    for (std::size_t i = 1; i < uuids.size(); i += 2) ASSERT_TRUE(filter.contains(uuids[i]));
+    std::size_t remaining = 0;
+    for (std::size_t i = 0; i < uuids.size(); i += 2) remaining += filter.contains(uuids[i]);
+    EXPECT_LT(remaining, uuids.size() / 1000);
+
+    // round trip
+    std::vector<std::uint8_t> bytes = filter.to_bytes();
+    EXPECT_EQ(std::memcmp(bytes.data(), "U7Q1", 4), 0);
+    uuidv7::uuidv7_cuckoo_filter loaded = uuidv7::uuidv7_cuckoo_filter::from_bytes(bytes.data(), bytes.size());
+    EXPECT_EQ(loaded.size(), filter.size());
+    EXPECT_EQ(loaded.capacity(), filter.capacity());
+    for (std::size_t i = 1; i < uuids.size(); i += 2) ASSERT_TRUE(loaded.contains(uuids[i]));
+    EXPECT_THROW(uuidv7::uuidv7_cuckoo_filter::from_bytes(bytes.data(), bytes.size() - 8), uuidv7::invalid_format_error);
+    bytes[16]++; // size no longer matches the stored fingerprints
+    EXPECT_THROW(uuidv7::uuidv7_cuckoo_filter::from_bytes(bytes.data(), bytes.size()), uuidv7::invalid_format_error);
+    bytes[16]--;
+    bytes[1] = 0;
+    EXPECT_THROW(uuidv7::uuidv7_cuckoo_filter::from_bytes(bytes.data(), bytes.size()), uuidv7::invalid_format_error);
+
+    // with 2 buckets every fingerprint may use both: all 8 slots fill, then the victim
+    for (std::size_t first = 0; first + 9 <= absent.size(); first += 9) {
+        uuidv7::uuidv7_cuckoo_filter tiny(1);
+        ASSERT_EQ(tiny.capacity(), 8);
+        for (std::size_t i = first; i < first + 9; i++) ASSERT_TRUE(tiny.insert(absent[i]));
+        EXPECT_FALSE(tiny.insert(absent[0]));
+        for (std::size_t i = first; i < first + 9; i++) ASSERT_TRUE(tiny.contains(absent[i]));
+        std::vector<std::uint8_t> tiny_bytes = tiny.to_bytes();
+        ASSERT_EQ(uuidv7::uuidv7_cuckoo_filter::from_bytes(tiny_bytes.data(), tiny_bytes.size()).size(), 9);
+    }
+
+    // overfilling stops at a high load without losing inserted UUIDs
+    uuidv7::uuidv7_cuckoo_filter small(1000);
+    std::size_t inserted = 0;
+    while (inserted < absent.size() && small.insert(absent[inserted])) inserted++;
+    EXPECT_LT(inserted, absent.size());
+    EXPECT_GT(inserted, small.capacity() * 9 / 10);
+    EXPECT_EQ(small.size(), inserted);
+    for (std::size_t i = 0; i < inserted; i++) ASSERT_TRUE(small.contains(absent[i]));
+    for (std::size_t i = 0; i < inserted / 10; i++) ASSERT_TRUE(small.erase(absent[i]));
+    EXPECT_TRUE(small.insert(absent[0]));
+    EXPECT_EQ(small.size(), inserted - inserted / 10 + 1);
+
+    filter.clear();
+    EXPECT_EQ(filter.size(), 0);
+    EXPECT_FALSE(filter.contains(uuids[1]));
+}
+
+TEST(UUIDv7, FilterFormat)
+{
+    // the serialized forms are portable: the scalar, SSE2 and AVX2 builds must all produce these bytes
+    uuidv7::uuidv7_bloom_filter bloom(64);
+    uuidv7::uuidv7_cuckoo_filter cuckoo(16);
+    for (std::uint64_t i = 0; i < 16; i++) {
+        uuidv7::uuidv7 uuid = uuidv7::uuidv7::from_fields(0x0190'0000'0000 + i / 4, static_cast<std::uint16_t>(i * 0x111),
+                                                          i * 0x0123'4567'89ab'cdefULL & uuidv7::uuidv7::MAX_RAND_B);
+        bloom.insert(uuid);
+        cuckoo.insert(uuid);
+    }
+    auto to_hex = [](const std::vector<std::uint8_t>& bytes) {
+        std::string hex;
+        for (std::uint8_t b : bytes) hex += "0123456789abcdef"[b >> 4], hex += "0123456789abcdef"[b & 15];
+        return hex;
+    };
+    EXPECT_EQ(to_hex(bloom.bytes()),
+              "5537423101000000" "0300000000000000" + std::string(96, '0') +
+              "50010188034204080420001920d0240011600100400000b204067000410041400031320000010885001203029200803000"
+              "023029280000a004d022004000604301001102101014000800088401400a0080804008500500006000880000001640");
+    std::vector<std::uint8_t> cuckoo_bytes = cuckoo.to_bytes();
+    EXPECT_EQ(to_hex(cuckoo_bytes),
+              "5537513101000000" "0800000000000000" "1000000000000000" + std::string(80, '0') +
+              "11a68eeb00000000833d000000000000fa328b34000000009a73779d9c6e0000"
+              "8ed9aa23000000001ab335e0000000009986a89900000000bc27813c00000000");
+
+    // trailing bytes after the last block are rejected
+    std::vector<std::uint8_t> bloom_bytes = bloom.bytes();
+    bloom_bytes.push_back(0);
+    EXPECT_THROW(uuidv7::uuidv7_bloom_filter::from_bytes(bloom_bytes.data(), bloom_bytes.size()), uuidv7::invalid_format_error);
+    bloom_bytes.resize(bloom_bytes.size() - 1 + 32);
+    EXPECT_THROW(uuidv7::uuidv7_bloom_filter_view(bloom_bytes.data(), bloom_bytes.size()), uuidv7::invalid_format_error);
+    cuckoo_bytes.push_back(0);
+    EXPECT_THROW(uuidv7::uuidv7_cuckoo_filter::from_bytes(cuckoo_bytes.data(), cuckoo_bytes.size()), uuidv7::invalid_format_error);
+    cuckoo_bytes.resize(cuckoo_bytes.size() - 1 + 8);
+    EXPECT_THROW(uuidv7::uuidv7_cuckoo_filter::from_bytes(cuckoo_bytes.data(), cuckoo_bytes.size()), uuidv7::invalid_format_error);
+}
+
+TEST(UUIDv7, ConcurrentMap)
+{
+    std::vector<uuidv7::uuidv7> uuids;
+    uuidv7::uuidv7_generator generator;
+    for (int i = 0; i < 4000; i++) uuids.push_back(generator.generate());
+
+    uuidv7::uuidv7_concurrent_map<std::uint64_t> map(3000);
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.capacity(), 3000);
+    EXPECT_FALSE(map.find(uuids[0]).has_value());
+    for (std::uint64_t i = 0; i < 3000; i++) ASSERT_TRUE(map.insert(uuids[i], i));
+    EXPECT_THROW(map.insert(uuids[3000], 3000), std::length_error);
+    EXPECT_FALSE(map.insert(uuids[5], 50));
+    EXPECT_EQ(map.find(uuids[5]), std::optional<std::uint64_t>(5));
+    EXPECT_FALSE(map.insert_or_assign(uuids[5], 50));
+    EXPECT_EQ(map.find(uuids[5]), std::optional<std::uint64_t>(50));
+    EXPECT_EQ(map.size(), 3000);
+    EXPECT_FALSE(map.contains(uuids[3000]));
+
+    // erased slots are reused: the map can be churned indefinitely at full capacity
+    for (int round = 0; round < 3; round++) {
+        for (std::size_t i = 0; i < 1000; i++) ASSERT_EQ(map.erase(uuids[i]), 1);
+        EXPECT_EQ(map.erase(uuids[0]), 0);
+        for (std::size_t i = 0; i < 1000; i++) ASSERT_TRUE(map.insert(uuids[i + 3000], i));
+        for (std::size_t i = 0; i < 1000; i++) std::swap(uuids[i], uuids[i + 3000]);
+    }
+    std::size_t visited = 0;
+    map.for_each([&](const uuidv7::uuidv7& uuid, std::uint64_t value) {
+        visited++;
+        EXPECT_EQ(map.find(uuid), std::optional<std::uint64_t>(value));
+    });
+    EXPECT_EQ(visited, 3000);
+
+    // tombstones are reclaimed once no probe sequence crosses them, also across the end of the table
+    struct home_hash {
+        std::size_t operator()(const uuidv7::uuidv7& uuid) const noexcept { return static_cast<std::size_t>(uuid.rand_b()); }
+    };
+    uuidv7::uuidv7_concurrent_map<std::uint64_t, home_hash> probed(28); // 32 slots
+    auto at_home = [](std::uint64_t home, std::uint64_t n) { return uuidv7::uuidv7::from_fields(1, 0, home + n * 32); };
+    for (std::uint64_t n = 0; n < 3; n++) {
+        ASSERT_TRUE(probed.insert(at_home(3, n), n));  // slots 3, 4, 5
+        ASSERT_TRUE(probed.insert(at_home(31, n), n)); // slots 31, 0, 1
+    }
+    EXPECT_EQ(probed.erase(at_home(3, 1)), 1);
+    EXPECT_EQ(probed.erase(at_home(31, 1)), 1);
+    EXPECT_EQ(probed.reclaim(), 0); // the keys in slots 5 and 1 probed through both tombstones
+    EXPECT_EQ(probed.erase(at_home(3, 2)), 1);
+    EXPECT_EQ(probed.erase(at_home(31, 2)), 1);
+    EXPECT_EQ(probed.reclaim(), 4);
+    EXPECT_EQ(probed.find(at_home(3, 0)), std::optional<std::uint64_t>(0));
+    EXPECT_EQ(probed.find(at_home(31, 0)), std::optional<std::uint64_t>(0));
+    EXPECT_FALSE(probed.contains(at_home(3, 2)));
+    EXPECT_TRUE(probed.insert(at_home(31, 3), 3));
+    EXPECT_EQ(probed.find(at_home(31, 3)), std::optional<std::uint64_t>(3));
+
+    // readers always see the stable keys with a value of their own, while writers churn other keys
+    uuidv7::uuidv7_concurrent_map<std::uint64_t> shared(2048);
+    const std::size_t stable = 1024;
+    for (std::uint64_t i = 0; i < stable; i++) shared.insert(uuids[i], i << 1);
+    std::atomic<bool> done{false};
+    std::atomic<std::size_t> errors{0};
+    std::vector<std::thread> threads;
+    for (int r = 0; r < 4; r++) {
+        threads.emplace_back([&] {
+            while (!done.load()) {
+                for (std::uint64_t i = 0; i < stable; i++) {
+                    auto value = shared.find(uuids[i]);
+                    if (!value || (*value >> 1) != i) errors++;
+                }
+                for (std::uint64_t i = stable; i < 2000; i++) {
+                    auto value = shared.find(uuids[i]);
+                    if (value && *value != i) errors++;
+                }
+            }
+        });
+    }
+    for (int w = 0; w < 2; w++) {
+        threads.emplace_back([&, w] {
+            for (int round = 0; round < 50; round++) {
+                for (std::uint64_t i = stable + w; i < 2000; i += 2) shared.insert(uuids[i], i);
+                for (std::uint64_t i = w; i < stable; i += 2) shared.insert_or_assign(uuids[i], (i << 1) | (round & 1));
+                for (std::uint64_t i = stable + w; i < 2000; i += 2) shared.erase(uuids[i]);
+            }
+        });
+    }
+    for (std::size_t t = 4; t < threads.size(); t++) threads[t].join();
+    done = true;
+    for (std::size_t t = 0; t < 4; t++) threads[t].join();
+    EXPECT_EQ(errors.load(), 0);
+    EXPECT_EQ(shared.size(), stable);
+}
+
+TEST(UUIDv7, Partition)
+{
+    auto at = [](std::uint64_t millis, std::uint64_t rand_b) { return uuidv7::uuidv7::from_fields(millis, 0, rand_b); };
+
+    // time buckets rotate over the shards
+    uuidv7::uuidv7_time_partitioner by_time(4, std::chrono::hours(1));
+    EXPECT_EQ(by_time.shard_count(), 4);
+    EXPECT_EQ(by_time.bucket(), std::chrono::hours(1));
+    EXPECT_EQ(by_time(at(0, 1)), 0);
+    EXPECT_EQ(by_time(at(3599999, 1)), 0);
+    EXPECT_EQ(by_time(at(3600000, 1)), 1);
+    EXPECT_EQ(by_time(at(3600000 * 5 + 7, 1)), 1);
+    EXPECT_THROW(uuidv7::uuidv7_time_partitioner(0, std::chrono::hours(1)), std::invalid_argument);
+    EXPECT_THROW(uuidv7::uuidv7_time_partitioner(4, std::chrono::milliseconds(0)), std::invalid_argument);
+
+    // the batched shards match the single ones, also for input out of time order
+    std::vector<uuidv7::uuidv7> uuids;
+    std::mt19937_64 rng(48);
+    for (std::uint64_t i = 0; i < 5000; i++) uuids.push_back(at(1000000 + i * 3 + (i % 7 == 0 ? rng() % 100000 : 0), i));
+    uuids.push_back(at(0, 1));
+    std::vector<std::uint32_t> shards(uuids.size());
+    uuidv7::uuidv7_time_partitioner by_second(7, std::chrono::seconds(1));
+    by_second.shards(uuids.data(), uuids.size(), shards.data());
+    for (std::size_t i = 0; i < uuids.size(); i++) ASSERT_EQ(shards[i], by_second(uuids[i]));
+
+    // jump consistent hashing: uniform, and growing by one shard only moves UUIDs to the new shard
+    uuidv7::uuidv7_generator generator;
+    std::vector<uuidv7::uuidv7> generated;
+    for (int i = 0; i < 64000; i++) generated.push_back(generator.generate());
+    uuidv7::uuidv7_hash_partitioner by_hash(64), grown(65);
+    EXPECT_THROW(uuidv7::uuidv7_hash_partitioner(0), std::invalid_argument);
+    std::vector<std::size_t> counts(64);
+    std::size_t moved = 0;
+    for (const auto& uuid : generated) {
+        const std::size_t shard = by_hash(uuid);
+        ASSERT_LT(shard, 64);
+        counts[shard]++;
+        if (grown(uuid) != shard) {
+            ASSERT_EQ(grown(uuid), 64);
+            moved++;
+        }
+    }
+    for (std::size_t count : counts) EXPECT_NEAR(static_cast<double>(count), 1000.0, 150.0);
+    EXPECT_NEAR(static_cast<double>(moved), 64000.0 / 65, 150.0);
+
+    // contiguous ranges per shard, order kept within a shard
+    std::vector<uuidv7::uuidv7> out(generated.size(), generated[0]);
+    std::vector<std::size_t> offsets = uuidv7::partition_uuids(generated.data(), generated.data() + generated.size(), out.data(), by_hash);
+    ASSERT_EQ(offsets.size(), 65);
+    EXPECT_EQ(offsets.front(), 0);
+    EXPECT_EQ(offsets.back(), generated.size());
+    for (std::size_t s = 0; s < 64; s++) {
+        for (std::size_t i = offsets[s]; i < offsets[s + 1]; i++) ASSERT_EQ(by_hash(out[i]), s);
+        EXPECT_TRUE(std::is_sorted(out.begin() + static_cast<std::ptrdiff_t>(offsets[s]), out.begin() + static_cast<std::ptrdiff_t>(offsets[s + 1])));
+    }
+
+    // per-shard buffers, appended to
+    std::vector<std::vector<uuidv7::uuidv7>> buffers;
+    uuidv7::partition_uuids(uuids.data(), uuids.data() + 2500, by_second, buffers);
+    uuidv7::partition_uuids(uuids.data() + 2500, uuids.data() + uuids.size(), by_second, buffers);
+    ASSERT_EQ(buffers.size(), 7);
+    std::size_t total = 0;
+    for (std::size_t s = 0; s < 7; s++) {
+        total += buffers[s].size();
+        for (const auto& uuid : buffers[s]) ASSERT_EQ(by_second(uuid), s);
+    }
+    EXPECT_EQ(total, uuids.size());
+    std::vector<uuidv7::uuidv7> expected;
+    for (const auto& uuid : uuids) if (by_second(uuid) == 3) expected.push_back(uuid);
+    EXPECT_EQ(buffers[3], expected);
+}
+
+TEST(UUIDv7, TimeIndex)
+{
+    using ms_time_point = std::chrono::time_point<std::chrono::system_clock, std::chrono::milliseconds>;
+    auto at = [](std::int64_t millis) { return ms_time_point(std::chrono::milliseconds(millis)); };
+
+    // 1000 UUIDs: 10 per millisecond in [1000, 1100), inserted in reverse order
+    fixed_clock::millis = 1000;
+    uuidv7::basic_uuidv7_generator<fixed_clock, uuidv7::csprng_entropy, uuidv7::null_lock, uuidv7::increment_counter> generator;
+    std::vector<uuidv7::uuidv7> uuids;
+    for (int i = 0; i < 1000; i++) {
+        if (i % 10 == 0) fixed_clock::millis = 1000 + i / 10;
+        uuids.push_back(generator.generate());
+    }
+    uuidv7::uuidv7_time_index index(uuids.rbegin(), uuids.rend());
+    ASSERT_EQ(index.size(), 1000);
+    EXPECT_TRUE(std::is_sorted(index.begin(), index.end()));
+
+    // time ranges (inclusive)
+    auto range = index.find_range(at(1010), at(1019));
+    EXPECT_EQ(range.first - index.begin(), 100);
+    EXPECT_EQ(range.second - index.begin(), 200);
+    EXPECT_EQ(index.count_range(at(1000), at(1099)), 1000);
+    EXPECT_EQ(index.count_range(at(1099), at(5000)), 10);
+    EXPECT_EQ(index.count_range(at(0), at(999)), 0);
+    EXPECT_EQ(index.count_range(at(1050), at(1040)), 0);
+    EXPECT_EQ(index.count_range(at(1050) + std::chrono::microseconds(500), at(1050)), 10);
+
+    // point lookups
+    for (std::size_t i = 0; i < uuids.size(); i += 7) {
+        EXPECT_TRUE(index.contains(uuids[i]));
+        EXPECT_EQ(*index.lower_bound(uuids[i]), uuids[i]);
+    }
+    EXPECT_FALSE(index.contains(uuidv7::uuidv7::min_for_time(at(1000))));
+    EXPECT_EQ(index.lower_bound(uuidv7::uuidv7::max_for_time(at(1099))), index.end());
+    EXPECT_EQ(uuidv7::uuidv7_time_index().count_range(at(0), at(5000)), 0);
+}
+
+TEST(UUIDv7, SortUUIDs)
+{
+    // UUIDs sharing the timestamp prefix, some duplicated, in random order
+    std::mt19937_64 rng(7);
+    std::vector<uuidv7::uuidv7> uuids;
+    for (int i = 0; i < 100000; i++) {
+        std::array<uint8_t, 16> bytes = {};
+        std::uint64_t value = rng();
+        for (int k = 0; k < 8; k++) bytes[8 + k] = static_cast<uint8_t>(value >> (k * 8));
+        bytes[4] = static_cast<uint8_t>(i % 3);
+        bytes[6] = 0x70 | (value & 0x0F);
+        bytes[8] = (bytes[8] & 0x3F) | 0x80;
+        uuids.push_back(uuidv7::uuidv7::from_bytes(bytes));
+        if (i % 1000 == 0) uuids.push_back(uuids.back());
+    }
+    std::vector<uuidv7::uuidv7> expected = uuids;
+    std::sort(expected.begin(), expected.end());
+
+    std::vector<uuidv7::uuidv7> sorted = uuids;
+    uuidv7::sort_uuids(sorted.data(), sorted.data() + sorted.size());
+    EXPECT_EQ(sorted, expected);
+
+    for (unsigned threads : { 2u, 3u, 8u }) {
+        sorted = uuids;
+        uuidv7::sort_uuids_parallel(sorted.data(), sorted.data() + sorted.size(), threads);
+        EXPECT_EQ(sorted, expected);
+    }
+
+    // small and already sorted input
+    sorted.assign(uuids.begin(), uuids.begin() + 10);
+    uuidv7::sort_uuids(sorted.data(), sorted.data() + sorted.size());
+    EXPECT_TRUE(std::is_sorted(sorted.begin(), sorted.end()));
+    uuidv7::sort_uuids(expected.data(), expected.data() + expected.size());
+    EXPECT_TRUE(std::is_sorted(expected.begin(), expected.end()));
+}
+
+TEST(UUIDv7, MergeUUIDs)
+{
+    // 7 sorted runs with overlapping ranges, duplicates across runs and an empty run
+    std::vector<std::vector<uuidv7::uuidv7>> runs(7);
+    std::vector<uuidv7::uuidv7> expected;
+    fixed_clock::millis = 1000;
+    uuidv7::basic_uuidv7_generator<fixed_clock, uuidv7::csprng_entropy, uuidv7::null_lock, uuidv7::increment_counter> generator;
+    for (int i = 0; i < 200000; i++) {
+        if (i % 100 == 0) fixed_clock::millis++;
+        uuidv7::uuidv7 uuid = generator.generate();
+        std::size_t run = (i * 7919) % 6;
+        runs[run].push_back(uuid);
+        expected.push_back(uuid);
+        if (i % 1000 == 0) {
+            runs[(run + 1) % 6].push_back(uuid);
+            expected.push_back(uuid);
+        }
+    }
+    std::vector<uuidv7::uuidv7_run> pointer_runs;
+    for (const auto& run : runs) pointer_runs.emplace_back(run.data(), run.data() + run.size());
+
+    std::vector<uuidv7::uuidv7> merged = expected;
+    EXPECT_EQ(uuidv7::merge_uuids(pointer_runs, merged.data()), merged.data() + merged.size());
+    EXPECT_EQ(merged, expected);
+
+    for (unsigned threads : { 2u, 3u, 8u }) {
+        merged.assign(expected.size(), uuidv7::uuidv7::min_for_time(std::chrono::system_clock::time_point()));
+        EXPECT_EQ(uuidv7::merge_uuids_parallel(pointer_runs, merged.data(), threads), merged.data() + merged.size());
+        EXPECT_EQ(merged, expected);
+    }
+
+    // runs of one repeated value
+    std::vector<uuidv7::uuidv7> same(50000, expected[0]);
+    std::vector<uuidv7::uuidv7_run> same_runs(4, { same.data(), same.data() + same.size() });
+    merged.assign(same.size() * 4, expected[1]);
+    EXPECT_EQ(uuidv7::merge_uuids_parallel(same_runs, merged.data(), 3), merged.data() + merged.size());
+    EXPECT_EQ(std::count(merged.begin(), merged.end(), expected[0]), 200000);
+
+    // trivial inputs
+    EXPECT_EQ(uuidv7::merge_uuids({}, merged.data()), merged.data());
+    EXPECT_EQ(uuidv7::merge_uuids({ pointer_runs[6] }, merged.data()), merged.data());
+}
+
+TEST(UUIDv7, ColumnCodec)
+{
+    // generator output: 50 UUIDs per millisecond, plus a carry into rand_a and unordered tail
+    fixed_clock::millis = 1000;
+    uuidv7::basic_uuidv7_generator<fixed_clock, uuidv7::csprng_entropy, uuidv7::null_lock, uuidv7::increment_counter> generator;
+    std::vector<uuidv7::uuidv7> uuids;
+    for (int i = 0; i < 1000; i++) {
+        if (i % 50 == 0) fixed_clock::millis++;
+        uuids.push_back(generator.generate());
+    }
+    uuids.push_back(uuidv7::uuidv7::from_fields(5000, 0x100, uuidv7::uuidv7::MAX_RAND_B));
+    uuids.push_back(uuidv7::uuidv7::from_fields(5000, 0x101, 3));
+    uuids.push_back(uuidv7::uuidv7::from_fields(10, 0x100, 0));
+    uuids.push_back(uuidv7::uuidv7::from_fields(0xFFFFFFFFFFFF, 0, 0));
+
+    std::vector<std::uint8_t> encoded = uuidv7::uuidv7_column_codec::encode(uuids.data(), uuids.data() + uuids.size());
+    EXPECT_LT(encoded.size(), uuids.size() * 4);
+    EXPECT_EQ(uuidv7::uuidv7_column_codec::decode(encoded.data(), encoded.size()), uuids);
+
+    // random access
+    uuidv7::uuidv7_column_codec::reader column(encoded.data(), encoded.size());
+    EXPECT_EQ(column.size(), uuids.size());
+    EXPECT_EQ(column.block_count(), (uuids.size() + 127) / 128);
+    for (std::size_t i = 0; i < uuids.size(); i += 37) EXPECT_EQ(column.at(i), uuids[i]);
+    EXPECT_EQ(column.at(uuids.size() - 1), uuids.back());
+    std::vector<uuidv7::uuidv7> block(column.block_size(), uuids[0]);
+    EXPECT_EQ(column.decode_block(2, block.data()), block.data() + 128);
+    EXPECT_TRUE(std::equal(block.begin(), block.end(), uuids.begin() + 256));
+    EXPECT_THROW(column.at(uuids.size()), std::out_of_range);
+
+    // empty column
+    encoded = uuidv7::uuidv7_column_codec::encode(uuids.data(), uuids.data());
+    EXPECT_TRUE(uuidv7::uuidv7_column_codec::decode(encoded.data(), encoded.size()).empty());
+
+    // malformed data
+    encoded = uuidv7::uuidv7_column_codec::encode(uuids.data(), uuids.data() + 100);
+    EXPECT_THROW(uuidv7::uuidv7_column_codec::decode(encoded.data(), 10), uuidv7::invalid_format_error);
+    EXPECT_THROW(uuidv7::uuidv7_column_codec::decode(encoded.data(), encoded.size() - 1), uuidv7::invalid_format_error);
+    encoded[0] = 'X';
+    EXPECT_THROW(uuidv7::uuidv7_column_codec::decode(encoded.data(), encoded.size()), uuidv7::invalid_format_error);
+
+    // header claiming more UUIDs than the input can hold, or a foreign block size: rejected before any allocation
+    auto header = [](std::uint64_t count, std::uint32_t block_size, std::uint32_t block_count) {
+        std::vector<std::uint8_t> bytes = { 'U', '7', 'C', '1' };
+        for (int i = 0; i < 8; i++) bytes.push_back(static_cast<std::uint8_t>(count >> (i * 8)));
+        for (int i = 0; i < 4; i++) bytes.push_back(static_cast<std::uint8_t>(block_size >> (i * 8)));
+        for (int i = 0; i < 4; i++) bytes.push_back(static_cast<std::uint8_t>(block_count >> (i * 8)));
+        bytes.resize(bytes.size() + 8 * block_count, 0);
+        return bytes;
+    };
+    std::vector<std::uint8_t> forged = header(0xFFFFFFFF, 0xFFFFFFFF, 1);
+    EXPECT_EQ(forged.size(), 28);
+    EXPECT_THROW(uuidv7::uuidv7_column_codec::decode(forged.data(), forged.size()), uuidv7::invalid_format_error);
+    forged = header(128, 128, 1);
+    EXPECT_THROW(uuidv7::uuidv7_column_codec::reader(forged.data(), forged.size()), uuidv7::invalid_format_error);
+    forged = header(1, 64, 1);
+    forged.resize(forged.size() + 16, 0);
+    EXPECT_THROW(uuidv7::uuidv7_column_codec::reader(forged.data(), forged.size()), uuidv7::invalid_format_error);
+}